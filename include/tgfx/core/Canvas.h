@@ -22,11 +22,13 @@
 #include "tgfx/core/BlendMode.h"
 #include "tgfx/core/Font.h"
 #include "tgfx/core/Image.h"
+#include "tgfx/core/Lattice.h"
 #include "tgfx/core/Paint.h"
 #include "tgfx/core/Path.h"
 #include "tgfx/core/Picture.h"
 #include "tgfx/core/SamplingOptions.h"
 #include "tgfx/core/TextBlob.h"
+#include "tgfx/core/Vertices.h"
 
 namespace tgfx {
 class Surface;
@@ -218,6 +220,38 @@ class Canvas {
    */
   void drawRRect(const RRect& rRect, const Paint& paint);
 
+  /**
+   * Draws an array of rectangles using the current clip, matrix, and specified paint. All the
+   * rectangles share the same state and are drawn as a single batch, which is much faster than
+   * calling drawRect() for each of them. If the paint has a stroke, the outlines of all rectangles
+   * are stroked as a single path.
+   */
+  void drawRects(const Rect rects[], size_t count, const Paint& paint);
+
+  /**
+   * Draws an array of RRects using the current clip, matrix, and specified paint. All the RRects
+   * share the same state and are drawn as a single batch, which is much faster than calling
+   * drawRRect() for each of them. If the paint has a stroke, the outlines of all RRects are stroked
+   * as a single path.
+   */
+  void drawRRects(const RRect rRects[], size_t count, const Paint& paint);
+
+  /**
+   * Draws an array of points using the current clip, matrix, and specified paint. Each point is
+   * drawn as a circle if the paint's line cap is LineCap::Round, otherwise as a square. The
+   * diameter or side length is the paint's stroke width, or one pixel if the stroke width is zero.
+   * The paint's style is ignored.
+   */
+  void drawPoints(const Point points[], size_t count, const Paint& paint);
+
+  /**
+   * Draws count / 2 separate line segments using the current clip, matrix, and specified paint.
+   * Each pair of consecutive points defines a segment, and the last point is ignored if count is
+   * odd. The segments are stroked with the paint's stroke options, and the paint's style is
+   * ignored.
+   */
+  void drawLines(const Point points[], size_t count, const Paint& paint);
+
   /**
    * Draws a path using the current clip, matrix, and specified paint.
    */
@@ -254,6 +288,36 @@ class Canvas {
   void drawImage(std::shared_ptr<Image> image, const SamplingOptions& sampling,
                  const Paint* paint = nullptr);
 
+  /**
+   * Draws an image stretched to fit into the dst rectangle, using current clip, matrix, and
+   * optional paint. The center rectangle divides the image into nine sections: four corners, four
+   * sides, and the center. Corners keep their size, or are scaled down proportionately if their
+   * sides are larger than dst. The center and the four sides are scaled to fill the remaining
+   * space. All sections are drawn as a single batch.
+   * @param image  the image to draw.
+   * @param center  the scalable center of the image, in image coordinates. It is rounded to
+   * integer coordinates.
+   * @param dst  the destination rectangle.
+   * @param filterMode  the filter mode used to sample the image.
+   * @param paint  optional paint, used to apply alpha, blend mode, color filter, and image filter.
+   */
+  void drawImageNine(std::shared_ptr<Image> image, const Rect& center, const Rect& dst,
+                     FilterMode filterMode = FilterMode::Linear, const Paint* paint = nullptr);
+
+  /**
+   * Draws an image stretched to fit into the dst rectangle according to the given Lattice, using
+   * current clip, matrix, and optional paint. Fixed columns and rows keep their size, or are
+   * scaled down proportionately if they are larger than dst. Scalable columns and rows share the
+   * remaining space. All sections are drawn as a single batch.
+   * @param image  the image to draw.
+   * @param lattice  the divisions of the image into fixed and scalable sections.
+   * @param dst  the destination rectangle.
+   * @param filterMode  the filter mode used to sample the image.
+   * @param paint  optional paint, used to apply alpha, blend mode, color filter, and image filter.
+   */
+  void drawImageLattice(std::shared_ptr<Image> image, const Lattice& lattice, const Rect& dst,
+                        FilterMode filterMode = FilterMode::Linear, const Paint* paint = nullptr);
+
   /**
    * Draws text, with origin at (x, y), using clip, matrix, font, and paint. The text must be in
    * utf-8 encoding. This function uses the default character-to-glyph mapping from the Typeface in
@@ -291,6 +355,16 @@ class Canvas {
    */
   void drawPicture(std::shared_ptr<Picture> picture, const Matrix* matrix, const Paint* paint);
 
+  /**
+   * Draws a triangle mesh using the current clip, matrix, and specified paint. If the vertices have
+   * texture coordinates, they are used as the local coordinates to sample the paint shader. If the
+   * vertices have colors, they replace the paint color and are modulated by the paint alpha. The
+   * stroke and image filter of the paint are ignored.
+   * @param vertices The triangle mesh to draw.
+   * @param paint blend, shader, alpha, and so on, used to draw.
+   */
+  void drawVertices(std::shared_ptr<Vertices> vertices, const Paint& paint);
+
   /**
    * Draws a set of sprites from the atlas using the current clip, matrix, and specified paint.
    * @param atlas Image containing the sprites.
@@ -313,6 +387,8 @@ class Canvas {
   explicit Canvas(DrawContext* drawContext);
   Canvas(DrawContext* drawContext, const Path& initClip);
   bool drawSimplePath(const Path& path, const FillStyle& style);
+  void drawRRectList(const std::vector<Rect>& rects, const std::vector<RRect>& rRects,
+                     const Path& path, const FillStyle& style);
   void drawImage(std::shared_ptr<Image> image, const SamplingOptions& sampling, const Paint* paint,
                  const Matrix* extraMatrix);
   void drawLayer(std::shared_ptr<Picture> picture, const MCState& state, const FillStyle& style,
@@ -24,6 +24,21 @@
 #include "tgfx/gpu/Context.h"
 
 namespace tgfx {
+/**
+ * Defines the direction in which ImageFilter::filterBounds() maps a rectangle.
+ */
+enum class MapDirection {
+  /**
+   * Maps the bounds of an input image to the bounds of the image produced by the filter.
+   */
+  Forward,
+  /**
+   * Maps a requested area of the filter output to the smallest area of the input image that
+   * contributes to it.
+   */
+  Reverse
+};
+
 /**
  * ImageFilter is the base class for all image filters. If one is installed in the Paint, then all
  * drawings occur as usual, but they are as if the drawings happened into an offscreen (before the
@@ -82,16 +97,17 @@ class ImageFilter {
 
   /**
    * Returns the bounds of the image that will be produced by this filter when it is applied to an
-   * image of the given bounds.
+   * image of the given bounds. If mapDirection is MapDirection::Reverse, returns instead the area
+   * of the input image that is needed to produce the given area of the output. The result is
+   * rounded out to integer bounds in both directions.
    */
-  Rect filterBounds(const Rect& rect) const;
+  Rect filterBounds(const Rect& rect, MapDirection mapDirection = MapDirection::Forward) const;
 
  protected:
   /**
-   * Returns the bounds of the image that will be produced by this filter when it is applied to an
-   * image of the given bounds.
+   * Maps the given rect through this filter in the given direction. See filterBounds() for details.
    */
-  virtual Rect onFilterBounds(const Rect& srcRect) const;
+  virtual Rect onFilterBounds(const Rect& rect, MapDirection mapDirection) const;
 
   /**
    * The returned processor is in the coordinate space of the source image.
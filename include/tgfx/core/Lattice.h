@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "tgfx/core/Rect.h"
+
+namespace tgfx {
+/**
+ * Lattice divides an image into a grid of rectangles for drawing with Canvas::drawImageLattice().
+ * The x-divs and y-divs split the image into columns and rows. Columns and rows alternate between
+ * fixed and scalable ones, starting with a fixed one. Fixed rectangles keep their size when the
+ * lattice is stretched, while scalable rectangles share the remaining space. If the first div is
+ * equal to the left or top edge of the bounds, the first column or row is scalable instead.
+ */
+struct Lattice {
+  /**
+   * The x-coordinates dividing the bounds into columns. Must be strictly increasing and lie
+   * within the bounds.
+   */
+  const int* xDivs = nullptr;
+
+  /**
+   * The y-coordinates dividing the bounds into rows. Must be strictly increasing and lie within
+   * the bounds.
+   */
+  const int* yDivs = nullptr;
+
+  /**
+   * The number of x-divs.
+   */
+  int xCount = 0;
+
+  /**
+   * The number of y-divs.
+   */
+  int yCount = 0;
+
+  /**
+   * The source bounds of the image to draw, or nullptr to use the entire image.
+   */
+  const Rect* bounds = nullptr;
+};
+}  // namespace tgfx
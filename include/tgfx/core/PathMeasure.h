@@ -27,7 +27,9 @@ namespace tgfx {
 class PathMeasure {
  public:
   /**
-   * Initialize the PathMeasure with the specified path.
+   * Initialize the PathMeasure with the specified path. The measurement of a path is computed once
+   * and shared by all PathMeasures created from the same path or its unmodified copies, so calling
+   * this repeatedly on the same path is cheap.
    */
   static std::unique_ptr<PathMeasure> MakeFrom(const Path& path);
 
@@ -53,6 +55,22 @@ class PathMeasure {
    */
   virtual bool getPosTan(float distance, Point* position, Point* tangent) = 0;
 
+  /**
+   * Computes the positions and tangents at count distances in a single call. Each distance is
+   * pinned to 0 <= distance <= getLength(). Either positions or tangents may be nullptr if not
+   * needed. Returns false if there is no path, or a zero-length path was specified, in which case
+   * positions and tangents are unchanged.
+   */
+  virtual bool getPosTan(const float distances[], size_t count, Point positions[],
+                         Point tangents[]);
+
+  /**
+   * Cuts count segments in a single call, the i-th segment lies between startD[i] and stopD[i] and
+   * is written into results[i]. Returns the number of segments that are not zero-length.
+   */
+  virtual size_t getSegment(const float startD[], const float stopD[], size_t count,
+                            Path results[]);
+
   /**
    * Returns true if the current contour is closed().
    */
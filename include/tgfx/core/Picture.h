@@ -41,6 +41,15 @@ class Picture {
    */
   Rect getBounds(const Matrix& matrix = Matrix::I()) const;
 
+  /**
+   * Returns true if any of the recorded drawings covers the point (x, y), in the coordinate space
+   * of the Picture. The test runs on the CPU and walks the drawings in reverse order, stopping at
+   * the first hit. Clips, strokes and glyph outlines are taken into account. Images and color
+   * glyphs are treated as opaque rectangles, and layers with an image filter are tested against
+   * their filtered bounds.
+   */
+  bool hitTest(float x, float y) const;
+
   /**
    * Replays the drawing commands on the specified canvas. In the case that the commands are
    * recorded, each command in the Picture is sent separately to canvas. To add a single command to
@@ -58,6 +67,8 @@ class Picture {
   friend class DrawContext;
   friend class RenderContext;
   friend class RecordingContext;
+  friend class LayerUnrollContext;
   friend class Canvas;
+  friend class PictureImage;
 };
 }  // namespace tgfx
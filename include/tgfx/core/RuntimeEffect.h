@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "tgfx/core/ColorFilter.h"
+#include "tgfx/core/Shader.h"
+
+namespace tgfx {
+/**
+ * RuntimeEffect is a custom fragment stage written in GLSL, which can be turned into a Shader or a
+ * ColorFilter and runs as part of the same draw instead of requiring extra offscreen passes.
+ * The code is the body of a function with the following signature:
+ *
+ *   vec4 main(vec2 coord, vec4 color)
+ *
+ * where coord is the local coordinate of the fragment and color is the premultiplied input color,
+ * which for a Shader is the paint color. The function must return a premultiplied color. Each
+ * declared uniform is passed in as a parameter with the declared name, and each child shader is
+ * passed in as a vec4 parameter named child0, child1, and so on, holding the color of that child at
+ * the current fragment.
+ */
+class RuntimeEffect {
+ public:
+  /**
+   * Possible types of a uniform declared by a RuntimeEffect.
+   */
+  enum class UniformType {
+    Float,
+    Float2,
+    Float3,
+    Float4,
+    Float2x2,
+    Float3x3,
+    Float4x4,
+  };
+
+  /**
+   * Describes a uniform declared by a RuntimeEffect.
+   */
+  struct Uniform {
+    std::string name;
+    UniformType type = UniformType::Float;
+  };
+
+  /**
+   * Creates a new RuntimeEffect from the given GLSL code, uniforms, and number of child shaders.
+   * Returns nullptr if the code is empty or if any uniform name is not a valid identifier, is
+   * duplicated, or clashes with the coord, color, or child parameters. Compile errors in the code
+   * are only reported when the effect is first drawn, in which case the draw is skipped.
+   */
+  static std::shared_ptr<RuntimeEffect> Make(std::string code, std::vector<Uniform> uniforms = {},
+                                             size_t childCount = 0);
+
+  /**
+   * Returns the GLSL code of the effect.
+   */
+  const std::string& code() const {
+    return _code;
+  }
+
+  /**
+   * Returns the uniforms declared by the effect.
+   */
+  const std::vector<Uniform>& uniforms() const {
+    return _uniforms;
+  }
+
+  /**
+   * Returns the number of child shaders the effect expects.
+   */
+  size_t childCount() const {
+    return _childCount;
+  }
+
+  /**
+   * Returns the number of floats required to hold the values of all uniforms, in declaration order.
+   * Matrix uniforms are stored in column-major order.
+   */
+  size_t uniformSize() const;
+
+  /**
+   * Creates a Shader that runs the effect with the given uniform values and child shaders. Returns
+   * nullptr if the number of uniform values does not match uniformSize() or if the number of
+   * children does not match childCount().
+   */
+  std::shared_ptr<Shader> makeShader(std::vector<float> uniformValues,
+                                     std::vector<std::shared_ptr<Shader>> children = {}) const;
+
+  /**
+   * Creates a ColorFilter that runs the effect with the given uniform values. The coord passed to
+   * the effect is the local coordinate of the draw being filtered. Returns nullptr if the number of
+   * uniform values does not match uniformSize() or if the effect expects child shaders.
+   */
+  std::shared_ptr<ColorFilter> makeColorFilter(std::vector<float> uniformValues) const;
+
+ private:
+  uint32_t uniqueID = 0;
+  std::string _code;
+  std::vector<Uniform> _uniforms;
+  size_t _childCount = 0;
+  std::weak_ptr<RuntimeEffect> weakThis;
+
+  RuntimeEffect(std::string code, std::vector<Uniform> uniforms, size_t childCount);
+
+  friend class RuntimeFragmentProcessor;
+};
+}  // namespace tgfx
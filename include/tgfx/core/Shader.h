@@ -24,6 +24,7 @@
 #include "tgfx/core/ColorFilter.h"
 #include "tgfx/core/Image.h"
 #include "tgfx/core/Matrix.h"
+#include "tgfx/core/Picture.h"
 #include "tgfx/core/Point.h"
 #include "tgfx/core/SamplingOptions.h"
 #include "tgfx/core/TileMode.h"
@@ -51,6 +52,23 @@ class Shader {
                                                  TileMode tileModeY = TileMode::Clamp,
                                                  const SamplingOptions& sampling = {});
 
+  /**
+   * Creates a shader that tiles the content of the specified picture. The tile is rasterized into a
+   * texture at a power-of-two scale close to the drawing scale, and the texture is reused by later
+   * draws at similar scales.
+   * @param picture The picture to tile.
+   * @param tileModeX The tile mode in the x direction.
+   * @param tileModeY The tile mode in the y direction.
+   * @param localMatrix Optional matrix applied to the picture before tiling.
+   * @param tile Optional tile rectangle in picture coordinates. If nullptr, the bounds of the
+   * picture are used.
+   */
+  static std::shared_ptr<Shader> MakePictureShader(std::shared_ptr<Picture> picture,
+                                                   TileMode tileModeX = TileMode::Repeat,
+                                                   TileMode tileModeY = TileMode::Repeat,
+                                                   const Matrix* localMatrix = nullptr,
+                                                   const Rect* tile = nullptr);
+
   /**
    * Creates a shader that blends the two specified shaders.
    */
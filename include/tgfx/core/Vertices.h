@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "tgfx/core/Color.h"
+#include "tgfx/core/Rect.h"
+
+namespace tgfx {
+/**
+ * Vertices is an immutable triangle mesh that can be drawn with Canvas::drawVertices(). Each
+ * vertex has a position and may also have a texture coordinate and a color. The mesh is uploaded
+ * to the GPU as it is, without any path triangulation.
+ */
+class Vertices {
+ public:
+  /**
+   * Creates a Vertices by copying the given arrays.
+   * @param positions The positions of the vertices, required.
+   * @param texCoords Maybe nullptr. The texture coordinates of the vertices, which are the local
+   * coordinates used to sample the shader of the paint. If nullptr, the positions are used instead.
+   * @param colors Maybe nullptr. The colors of the vertices, which replace the paint color and are
+   * modulated by the paint alpha.
+   * @param vertexCount The number of vertices.
+   * @param indices Maybe nullptr. Every three indices form a triangle. If nullptr, every three
+   * consecutive vertices form a triangle instead.
+   * @param indexCount The number of indices.
+   * Returns nullptr if there are not enough vertices or indices for a single triangle, or if any
+   * index is out of range.
+   */
+  static std::shared_ptr<Vertices> MakeCopy(const Point positions[], const Point texCoords[],
+                                            const Color colors[], size_t vertexCount,
+                                            const uint16_t indices[] = nullptr,
+                                            size_t indexCount = 0);
+
+  /**
+   * Returns the bounds of the vertex positions.
+   */
+  const Rect& bounds() const {
+    return _bounds;
+  }
+
+  /**
+   * Returns the number of vertices.
+   */
+  size_t vertexCount() const {
+    return _positions.size();
+  }
+
+  /**
+   * Returns the number of indices, which is zero if the mesh is not indexed.
+   */
+  size_t indexCount() const {
+    return _indices.size();
+  }
+
+  /**
+   * Returns the positions of the vertices.
+   */
+  const std::vector<Point>& positions() const {
+    return _positions;
+  }
+
+  /**
+   * Returns the texture coordinates of the vertices, which is empty if there are none.
+   */
+  const std::vector<Point>& texCoords() const {
+    return _texCoords;
+  }
+
+  /**
+   * Returns the colors of the vertices, which is empty if there are none.
+   */
+  const std::vector<Color>& colors() const {
+    return _colors;
+  }
+
+  /**
+   * Returns the indices of the mesh, which is empty if the mesh is not indexed.
+   */
+  const std::vector<uint16_t>& indices() const {
+    return _indices;
+  }
+
+ private:
+  std::vector<Point> _positions = {};
+  std::vector<Point> _texCoords = {};
+  std::vector<Color> _colors = {};
+  std::vector<uint16_t> _indices = {};
+  Rect _bounds = Rect::MakeEmpty();
+
+  Vertices() = default;
+};
+}  // namespace tgfx
@@ -31,6 +31,7 @@ class DrawingManager;
 class Gpu;
 class ResourceProvider;
 class ProxyProvider;
+class ShareGroup;
 
 class Context {
  public:
@@ -69,6 +70,14 @@ class Context {
     return _proxyProvider;
   }
 
+  /**
+   * Returns the ShareGroup of the contexts that share GPU objects with this context, or nullptr if
+   * the backend does not support sharing.
+   */
+  ShareGroup* shareGroup() const {
+    return _shareGroup.get();
+  }
+
   /**
    * Returns the number of bytes consumed by internal gpu caches.
    */
@@ -175,6 +184,7 @@ class Context {
   explicit Context(Device* device);
 
   Gpu* _gpu = nullptr;
+  std::shared_ptr<ShareGroup> _shareGroup = nullptr;
 
  private:
   Device* _device = nullptr;
@@ -18,7 +18,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 #include "tgfx/core/Matrix.h"
 
 namespace tgfx {
@@ -51,6 +53,32 @@ class Device {
    */
   void unlock();
 
+  /**
+   * Pins the device to the calling thread. The device is locked and its context is made current
+   * until unpin() is called, so that lockContext() and unlock() on the same thread only return
+   * the context without touching the mutex or the backend context state. Any other thread calling
+   * lockContext() blocks until the device is unpinned. Returns false if the device is already
+   * pinned by another thread or if the context can not be locked on the calling thread. Calling
+   * it again on the pinned thread does nothing and returns true. Do not call it while the device
+   * is locked by lockContext() on the calling thread. A pinned device must be unpinned on its
+   * pinned thread before it is released or destroyed on any other thread, otherwise its GPU
+   * resources are leaked.
+   */
+  bool pinToCurrentThread();
+
+  /**
+   * Unpins the device from the calling thread, releasing the lock acquired by
+   * pinToCurrentThread(). Does nothing if the device is not pinned to the calling thread.
+   */
+  void unpin();
+
+  /**
+   * Returns true if the device is pinned to the calling thread.
+   */
+  bool isPinnedToCurrentThread() const {
+    return pinnedThread.load(std::memory_order_acquire) == std::this_thread::get_id();
+  }
+
  protected:
   std::mutex locker = {};
   Context* context = nullptr;
@@ -64,6 +92,7 @@ class Device {
  private:
   uint32_t _uniqueID = 0;
   bool contextLocked = false;
+  std::atomic<std::thread::id> pinnedThread = {};
 
   friend class ResourceCache;
 };
@@ -180,7 +180,9 @@ class Surface {
    * Returns an Image capturing the Surface contents. Subsequent drawings to the Surface contents
    * are not captured. This method would trigger immediate texture copying if the Surface has no
    * backing texture or the backing texture was allocated externally. For example, the Surface was
-   * created from a BackendRenderTarget, a BackendTexture or a HardwareBuffer.
+   * created from a BackendRenderTarget, a BackendTexture or a HardwareBuffer. Releasing the
+   * previous snapshot before taking a new one lets the Surface copy only the areas drawn in between
+   * instead of the whole content.
    */
   std::shared_ptr<Image> makeImageSnapshot();
 
@@ -194,6 +196,14 @@ class Surface {
    */
   Color getColor(int x, int y);
 
+  /**
+   * Returns the pixels at the given points as colors, in the same way as getColor(). Each point is
+   * truncated to the pixel that contains it, and points outside the Surface bounds get a
+   * transparent color. Unlike calling getColor() repeatedly, all points are sampled with a single
+   * flush and a single pixel readback, which avoids stalling the GPU once per point.
+   */
+  std::vector<Color> getColors(const std::vector<Point>& points);
+
   /**
    * Copies a rect of pixels to dstPixels with specified ImageInfo. Copy starts at (srcX, srcY), and
    * does not exceed Surface (width(), height()). Pixels are copied only if pixel conversion is
@@ -201,19 +211,72 @@ class Surface {
    */
   bool readPixels(const ImageInfo& dstInfo, void* dstPixels, int srcX = 0, int srcY = 0);
 
+  /**
+   * Returns the bounds of the area that has been drawn to since the Surface was created or since
+   * the last call to resetDamage(), in the coordinate space of the Surface with a top-left origin.
+   * Returns an empty Rect if nothing has been drawn. This can be used to present or upload only the
+   * changed part of the Surface.
+   */
+  Rect getDamagedBounds() const {
+    return damagedBounds;
+  }
+
+  /**
+   * Resets the accumulated damage of the Surface to empty.
+   */
+  void resetDamage() {
+    damagedBounds.setEmpty();
+  }
+
  private:
   std::shared_ptr<RenderTargetProxy> renderTargetProxy = nullptr;
   SurfaceOptions surfaceOptions = {};
   RenderContext* renderContext = nullptr;
   Canvas* canvas = nullptr;
   std::shared_ptr<Image> cachedImage = nullptr;
+  Rect damagedBounds = Rect::MakeEmpty();
+  std::shared_ptr<RenderTargetProxy> copySource = nullptr;
+  std::weak_ptr<Image> copySourceImage;
+  std::vector<Rect> copiedRects = {};
 
   static std::shared_ptr<Surface> MakeFrom(std::shared_ptr<RenderTargetProxy> renderTargetProxy,
                                            const SurfaceOptions* options = nullptr);
 
   Surface(std::shared_ptr<RenderTargetProxy> proxy, const SurfaceOptions* options);
 
-  bool aboutToDraw(const std::function<bool()>& willDiscardContent);
+  /**
+   * Called before drawing to the area of deviceBounds. If a snapshot is still referenced, the
+   * Surface switches to a new render target and copies the old content lazily, only the part under
+   * deviceBounds is copied right away.
+   */
+  bool aboutToDraw(const Rect& deviceBounds, const std::function<bool()>& willDiscardContent);
+
+  bool detachFromSnapshot(const std::function<bool()>& willDiscardContent);
+
+  /**
+   * Copies the old content under deviceBounds from the pending copy source, if any.
+   */
+  void copyPendingContent(const Rect& deviceBounds);
+
+  /**
+   * Makes the whole content available in the current render target before it is exposed.
+   */
+  void resolvePendingContent();
+
+  /**
+   * Switches back to the pending copy source once its snapshot is released, copying only the areas
+   * drawn since the switch into it. Returns false if the snapshot is still referenced.
+   */
+  bool restoreCopySource();
+
+  /**
+   * Returns true if the pixel at the top-left based position has not been copied from the pending
+   * copy source yet.
+   */
+  bool isPendingPixel(const Point& pixel) const;
+
+  void copyRenderTarget(std::shared_ptr<RenderTargetProxy> source,
+                        std::shared_ptr<TextureProxy> dest, const std::vector<Rect>& rects);
 
   friend class RenderContext;
 };
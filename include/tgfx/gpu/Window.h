@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <deque>
 #include "tgfx/gpu/Context.h"
 #include "tgfx/gpu/Surface.h"
 
@@ -49,6 +50,17 @@ class Window {
    */
   void present(Context* context, int64_t presentationTime = INT64_MIN);
 
+  /**
+   * Limits the rendering of the next frame to the changed area of the window. The dirtyRect is the
+   * area whose content changes in the next frame, in window coordinates with a top-left origin. The
+   * back buffer may hold an older frame than the last presented one, so the returned area can be
+   * larger than dirtyRect: it covers everything that must be repainted to bring the back buffer up
+   * to date, or the whole window if the age of the back buffer is unknown. The Canvas of the window
+   * Surface is clipped to the returned area until the next call to present(), which skips all draws
+   * outside of it. Returns an empty Rect if the Surface is unavailable.
+   */
+  Rect setDirtyRect(Context* context, const Rect& dirtyRect);
+
   /**
    * Invalidates the cached surface associated with this Window. This is useful when the window is
    * resized and the surface needs to be recreated.
@@ -66,6 +78,11 @@ class Window {
   bool sizeInvalid = false;
   std::shared_ptr<Device> device = nullptr;
   std::shared_ptr<Surface> surface = nullptr;
+  /**
+   * The area that changed in the frame being presented, in window coordinates with a top-left
+   * origin. It is only valid inside onPresent(), and an empty Rect means the whole window changed.
+   */
+  Rect presentDamage = Rect::MakeEmpty();
 
   explicit Window(std::shared_ptr<Device> device);
   Window() = default;
@@ -74,7 +91,28 @@ class Window {
   virtual void onPresent(Context* context, int64_t presentationTime) = 0;
   virtual void onFreeSurface();
 
+  /**
+   * Returns how many frames ago the content of the current back buffer was presented. Returns 0 if
+   * the content is unknown, which forces a full repaint in setDirtyRect().
+   */
+  virtual int onQueryBufferAge() {
+    return 0;
+  }
+
+  /**
+   * Notifies the window that only the repaintRect will be drawn in the next frame, in window
+   * coordinates with a top-left origin.
+   */
+  virtual void onSetDamageRegion(const Rect&) {
+  }
+
  private:
+  std::deque<Rect> damageHistory = {};
+  size_t dirtySaveCount = 0;
+  bool hasDirtyRect = false;
+
   bool checkContext(Context* context);
+  std::shared_ptr<Surface> getOrCreateSurface(Context* context, bool queryOnly);
+  void finishFrame();
 };
 }  // namespace tgfx
@@ -21,6 +21,8 @@
 #include "tgfx/gpu/Device.h"
 
 namespace tgfx {
+class ShareGroup;
+
 /**
  * The OpenGL interface for drawing graphics.
  */
@@ -63,7 +65,13 @@ class GLDevice : public Device {
 
  protected:
   void* nativeHandle = nullptr;
+  /**
+   * Identifies the native share group of this device, which is the same for every device whose
+   * OpenGL contexts share objects with each other. Defaults to the native handle.
+   */
+  void* shareRoot = nullptr;
   bool externallyOwned = false;
+  std::shared_ptr<ShareGroup> shareGroup = nullptr;
 
   explicit GLDevice(void* nativeHandle);
   bool onLockContext() override;
@@ -71,6 +79,9 @@ class GLDevice : public Device {
   virtual bool onMakeCurrent() = 0;
   virtual void onClearCurrent() = 0;
 
+ private:
+  std::shared_ptr<ShareGroup> findShareGroup() const;
+
   friend class GLContext;
 };
 }  // namespace tgfx
@@ -44,6 +44,7 @@ using GLBindBuffer = void GL_FUNCTION_TYPE(unsigned target, unsigned buffer);
 using GLBindVertexArray = void GL_FUNCTION_TYPE(unsigned vertexArray);
 using GLBindFramebuffer = void GL_FUNCTION_TYPE(unsigned target, unsigned framebuffer);
 using GLBindRenderbuffer = void GL_FUNCTION_TYPE(unsigned target, unsigned renderbuffer);
+using GLBindSampler = void GL_FUNCTION_TYPE(unsigned unit, unsigned sampler);
 using GLBindTexture = void GL_FUNCTION_TYPE(unsigned target, unsigned texture);
 using GLBlendColor = void GL_FUNCTION_TYPE(float red, float green, float blue, float alpha);
 using GLBlendEquation = void GL_FUNCTION_TYPE(unsigned mode);
@@ -79,6 +80,7 @@ using GLDeleteBuffers = void GL_FUNCTION_TYPE(int n, const unsigned* buffers);
 using GLDeleteFramebuffers = void GL_FUNCTION_TYPE(int n, const unsigned* framebuffers);
 using GLDeleteProgram = void GL_FUNCTION_TYPE(unsigned program);
 using GLDeleteRenderbuffers = void GL_FUNCTION_TYPE(int n, const unsigned* renderbuffers);
+using GLDeleteSamplers = void GL_FUNCTION_TYPE(int n, const unsigned* samplers);
 using GLDeleteShader = void GL_FUNCTION_TYPE(unsigned shader);
 using GLDeleteSync = void GL_FUNCTION_TYPE(void* sync);
 using GLDeleteTextures = void GL_FUNCTION_TYPE(int n, const unsigned* textures);
@@ -113,6 +115,7 @@ using GLGenVertexArrays = void GL_FUNCTION_TYPE(int n, unsigned* vertexArrays);
 using GLGenFramebuffers = void GL_FUNCTION_TYPE(int n, unsigned* framebuffers);
 using GLGenerateMipmap = void GL_FUNCTION_TYPE(unsigned target);
 using GLGenRenderbuffers = void GL_FUNCTION_TYPE(int n, unsigned* renderbuffers);
+using GLGenSamplers = void GL_FUNCTION_TYPE(int n, unsigned* samplers);
 using GLGenTextures = void GL_FUNCTION_TYPE(int n, unsigned* textures);
 using GLGetBooleanv = void GL_FUNCTION_TYPE(unsigned pname, unsigned char* data);
 using GLGetBufferParameteriv = void GL_FUNCTION_TYPE(unsigned target, unsigned pname, int* params);
@@ -162,6 +165,7 @@ using GLResolveMultisampleFramebuffer = void GL_FUNCTION_TYPE();
 using GLBlitFramebuffer = void GL_FUNCTION_TYPE(int srcX0, int srcY0, int srcX1, int srcY1,
                                                 int dstX0, int dstY0, int dstX1, int dstY1,
                                                 unsigned mask, unsigned filter);
+using GLSamplerParameteri = void GL_FUNCTION_TYPE(unsigned sampler, unsigned pname, int param);
 using GLScissor = void GL_FUNCTION_TYPE(int x, int y, int width, int height);
 using GLShaderSource = void GL_FUNCTION_TYPE(unsigned shader, int count, const char* const* str,
                                              const int* length);
@@ -236,6 +240,7 @@ class GLFunctions {
   GLBindBuffer* bindBuffer = nullptr;
   GLBindFramebuffer* bindFramebuffer = nullptr;
   GLBindRenderbuffer* bindRenderbuffer = nullptr;
+  GLBindSampler* bindSampler = nullptr;
   GLBindTexture* bindTexture = nullptr;
   GLBindVertexArray* bindVertexArray = nullptr;
   GLBlendColor* blendColor = nullptr;
@@ -262,6 +267,7 @@ class GLFunctions {
   GLDeleteFramebuffers* deleteFramebuffers = nullptr;
   GLDeleteProgram* deleteProgram = nullptr;
   GLDeleteRenderbuffers* deleteRenderbuffers = nullptr;
+  GLDeleteSamplers* deleteSamplers = nullptr;
   GLDeleteShader* deleteShader = nullptr;
   GLDeleteSync* deleteSync = nullptr;
   GLDeleteTextures* deleteTextures = nullptr;
@@ -286,6 +292,7 @@ class GLFunctions {
   GLGenFramebuffers* genFramebuffers = nullptr;
   GLGenerateMipmap* generateMipmap = nullptr;
   GLGenRenderbuffers* genRenderbuffers = nullptr;
+  GLGenSamplers* genSamplers = nullptr;
   GLGenTextures* genTextures = nullptr;
   GLGenVertexArrays* genVertexArrays = nullptr;
   GLGetBufferParameteriv* getBufferParameteriv = nullptr;
@@ -317,6 +324,7 @@ class GLFunctions {
   GLRenderbufferStorageMultisampleEXT* renderbufferStorageMultisampleEXT = nullptr;
   GLResolveMultisampleFramebuffer* resolveMultisampleFramebuffer = nullptr;
   GLBlitFramebuffer* blitFramebuffer = nullptr;
+  GLSamplerParameteri* samplerParameteri = nullptr;
   GLScissor* scissor = nullptr;
   GLShaderSource* shaderSource = nullptr;
   GLStencilFunc* stencilFunc = nullptr;
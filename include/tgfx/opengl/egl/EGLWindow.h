@@ -39,6 +39,8 @@ class EGLWindow : public Window {
  protected:
   std::shared_ptr<Surface> onCreateSurface(Context* context) override;
   void onPresent(Context* context, int64_t presentationTime) override;
+  int onQueryBufferAge() override;
+  void onSetDamageRegion(const Rect& repaintRect) override;
 
  private:
   EGLNativeWindowType nativeWindow;
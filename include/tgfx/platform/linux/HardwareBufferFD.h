@@ -0,0 +1,40 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "tgfx/platform/HardwareBuffer.h"
+
+namespace tgfx {
+/**
+ * Creates a HardwareBufferRef that shares the pixels of the given file descriptor, which may refer
+ * to a memfd, a shared-memory file or a dma-buf holding pixels laid out as described by info. The
+ * file descriptor is duplicated, so the caller keeps the ownership of fd. Only RGBA_8888 pixels with
+ * tight or 64-byte aligned rows are supported. Returns nullptr if the layout is not supported, the
+ * file is smaller than info.byteSize() or it can not be mapped. Call HardwareBufferRelease() when
+ * finished with the returned buffer.
+ */
+HardwareBufferRef HardwareBufferFromFD(int fd, const ImageInfo& info);
+
+/**
+ * Returns the file descriptor of the shared memory holding the pixels of the buffer, which can be
+ * passed to another process and imported there with HardwareBufferFromFD(). The file descriptor is
+ * owned by the buffer and must not be closed by the caller. Returns -1 if the buffer is invalid.
+ */
+int HardwareBufferGetFD(HardwareBufferRef buffer);
+}  // namespace tgfx
@@ -20,7 +20,9 @@
 #include "core/DrawContext.h"
 #include "core/LayerUnrollContext.h"
 #include "core/Records.h"
+#include "gpu/ops/RRectOp.h"
 #include "tgfx/core/PathEffect.h"
+#include "tgfx/core/Recorder.h"
 #include "tgfx/gpu/Surface.h"
 #include "utils/Log.h"
 #include "utils/SimpleTextShaper.h"
@@ -225,6 +227,173 @@ void Canvas::drawRRect(const RRect& rRect, const Paint& paint) {
   drawContext->drawRRect(rRect, *mcState, style);
 }
 
+void Canvas::drawRects(const Rect rects[], size_t count, const Paint& paint) {
+  if (rects == nullptr || count == 0 || paint.nothingToDraw()) {
+    return;
+  }
+  if (paint.getStroke()) {
+    Path path = {};
+    for (size_t i = 0; i < count; i++) {
+      path.addRect(rects[i]);
+    }
+    drawPath(path, paint);
+    return;
+  }
+  std::vector<Rect> rectList = {};
+  rectList.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    if (!rects[i].isEmpty()) {
+      rectList.push_back(rects[i]);
+    }
+  }
+  if (rectList.empty()) {
+    return;
+  }
+  auto style = CreateFillStyle(paint);
+  drawContext->drawRects(rectList, *mcState, style);
+}
+
+void Canvas::drawRRects(const RRect rRects[], size_t count, const Paint& paint) {
+  if (rRects == nullptr || count == 0 || paint.nothingToDraw()) {
+    return;
+  }
+  if (paint.getStroke()) {
+    Path path = {};
+    for (size_t i = 0; i < count; i++) {
+      path.addRRect(rRects[i]);
+    }
+    drawPath(path, paint);
+    return;
+  }
+  std::vector<Rect> rectList = {};
+  std::vector<RRect> rRectList = {};
+  rRectList.reserve(count);
+  Path path = {};
+  for (size_t i = 0; i < count; i++) {
+    auto& rRect = rRects[i];
+    if (rRect.rect.isEmpty()) {
+      continue;
+    }
+    if (rRect.radii.isZero()) {
+      rectList.push_back(rRect.rect);
+    } else if (RRectOp::CanDraw(rRect)) {
+      rRectList.push_back(rRect);
+    } else {
+      path.addRRect(rRect);
+    }
+  }
+  auto style = CreateFillStyle(paint);
+  drawRRectList(rectList, rRectList, path, style);
+}
+
+void Canvas::drawRRectList(const std::vector<Rect>& rects, const std::vector<RRect>& rRects,
+                           const Path& path, const FillStyle& style) {
+  if (!rects.empty()) {
+    drawContext->drawRects(rects, *mcState, style);
+  }
+  if (!rRects.empty()) {
+    drawContext->drawRRects(rRects, *mcState, style);
+  }
+  // RRects with tiny radii, such as hairline or sub-pixel round points, are drawn as one path.
+  if (!path.isEmpty()) {
+    drawContext->drawPath(path, *mcState, style, nullptr);
+  }
+}
+
+void Canvas::drawPoints(const Point points[], size_t count, const Paint& paint) {
+  if (points == nullptr || count == 0 || paint.nothingToDraw()) {
+    return;
+  }
+  auto width = paint.getStrokeWidth();
+  if (width <= 0) {
+    auto scale = mcState->matrix.getMaxScale();
+    if (scale <= 0) {
+      return;
+    }
+    width = 1.0f / scale;
+  }
+  auto radius = width * 0.5f;
+  auto style = CreateFillStyle(paint);
+  if (paint.getLineCap() == LineCap::Round) {
+    std::vector<RRect> rRects = {};
+    Path path = {};
+    for (size_t i = 0; i < count; i++) {
+      auto& point = points[i];
+      RRect rRect = {};
+      rRect.setOval(Rect::MakeLTRB(point.x - radius, point.y - radius, point.x + radius,
+                                   point.y + radius));
+      if (RRectOp::CanDraw(rRect)) {
+        rRects.push_back(rRect);
+      } else {
+        path.addOval(rRect.rect);
+      }
+    }
+    drawRRectList({}, rRects, path, style);
+  } else {
+    std::vector<Rect> rects(count);
+    for (size_t i = 0; i < count; i++) {
+      auto& point = points[i];
+      rects[i].setLTRB(point.x - radius, point.y - radius, point.x + radius, point.y + radius);
+    }
+    drawContext->drawRects(rects, *mcState, style);
+  }
+}
+
+/**
+ * Converts the line segments to rectangles if they are all horizontal or vertical, which is the
+ * common case for grids and axes.
+ */
+static bool LinesToRects(const Point points[], size_t segmentCount, const Stroke& stroke,
+                         std::vector<Rect>* rects) {
+  if (stroke.width <= 0 || stroke.cap == LineCap::Round) {
+    return false;
+  }
+  auto radius = stroke.width * 0.5f;
+  auto extension = stroke.cap == LineCap::Square ? radius : 0.0f;
+  rects->reserve(segmentCount);
+  for (size_t i = 0; i < segmentCount; i++) {
+    auto& p0 = points[i * 2];
+    auto& p1 = points[i * 2 + 1];
+    Rect rect = {};
+    if (p0.y == p1.y) {
+      rect.setLTRB(std::min(p0.x, p1.x) - extension, p0.y - radius,
+                   std::max(p0.x, p1.x) + extension, p0.y + radius);
+    } else if (p0.x == p1.x) {
+      rect.setLTRB(p0.x - radius, std::min(p0.y, p1.y) - extension, p0.x + radius,
+                   std::max(p0.y, p1.y) + extension);
+    } else {
+      return false;
+    }
+    if (!rect.isEmpty()) {
+      rects->push_back(rect);
+    }
+  }
+  return true;
+}
+
+void Canvas::drawLines(const Point points[], size_t count, const Paint& paint) {
+  auto segmentCount = count / 2;
+  if (points == nullptr || segmentCount == 0 || paint.nothingToDraw()) {
+    return;
+  }
+  auto realPaint = paint;
+  realPaint.setStyle(PaintStyle::Stroke);
+  std::vector<Rect> rects = {};
+  if (LinesToRects(points, segmentCount, *realPaint.getStroke(), &rects)) {
+    if (!rects.empty()) {
+      auto style = CreateFillStyle(paint);
+      drawContext->drawRects(rects, *mcState, style);
+    }
+    return;
+  }
+  Path path = {};
+  for (size_t i = 0; i < segmentCount; i++) {
+    path.moveTo(points[i * 2]);
+    path.lineTo(points[i * 2 + 1]);
+  }
+  drawPath(path, realPaint);
+}
+
 void Canvas::drawPath(const Path& path, const Paint& paint) {
   if (path.isEmpty() || paint.nothingToDraw()) {
     return;
@@ -317,6 +486,121 @@ void Canvas::drawImage(std::shared_ptr<Image> image, const SamplingOptions& samp
   drawContext->drawImageRect(std::move(image), sampling, rect, state, style);
 }
 
+void Canvas::drawImageNine(std::shared_ptr<Image> image, const Rect& center, const Rect& dst,
+                           FilterMode filterMode, const Paint* paint) {
+  if (image == nullptr) {
+    return;
+  }
+  auto centerRect = center;
+  centerRect.round();
+  if (!centerRect.intersect(Rect::MakeWH(image->width(), image->height()))) {
+    return;
+  }
+  int xDivs[] = {static_cast<int>(centerRect.left), static_cast<int>(centerRect.right)};
+  int yDivs[] = {static_cast<int>(centerRect.top), static_cast<int>(centerRect.bottom)};
+  Lattice lattice = {};
+  lattice.xDivs = xDivs;
+  lattice.yDivs = yDivs;
+  lattice.xCount = 2;
+  lattice.yCount = 2;
+  drawImageLattice(std::move(image), lattice, dst, filterMode, paint);
+}
+
+/**
+ * Computes the source and destination stops of the columns or rows of a lattice. The spans
+ * between the stops alternate between fixed and scalable ones, starting with a fixed one.
+ */
+static bool ComputeLatticeStops(const int* divs, int count, float srcStart, float srcEnd,
+                                float dstStart, float dstEnd, std::vector<float>* srcStops,
+                                std::vector<float>* dstStops) {
+  if (count < 0 || (count > 0 && divs == nullptr)) {
+    return false;
+  }
+  srcStops->push_back(srcStart);
+  for (int i = 0; i < count; i++) {
+    auto div = static_cast<float>(divs[i]);
+    if (div < srcStops->back() || div > srcEnd || (i > 0 && div == srcStops->back())) {
+      return false;
+    }
+    srcStops->push_back(div);
+  }
+  srcStops->push_back(srcEnd);
+  float fixedLength = 0;
+  float scalableLength = 0;
+  for (size_t i = 0; i + 1 < srcStops->size(); i++) {
+    auto length = (*srcStops)[i + 1] - (*srcStops)[i];
+    if (i % 2 == 0) {
+      fixedLength += length;
+    } else {
+      scalableLength += length;
+    }
+  }
+  auto dstLength = dstEnd - dstStart;
+  float fixedScale = 1.0f;
+  float scalableScale = 0.0f;
+  if (dstLength >= fixedLength && scalableLength > 0) {
+    scalableScale = (dstLength - fixedLength) / scalableLength;
+  } else if (fixedLength > 0) {
+    fixedScale = dstLength / fixedLength;
+  }
+  dstStops->push_back(dstStart);
+  for (size_t i = 0; i + 1 < srcStops->size(); i++) {
+    auto length = (*srcStops)[i + 1] - (*srcStops)[i];
+    auto scale = i % 2 == 0 ? fixedScale : scalableScale;
+    dstStops->push_back(dstStops->back() + length * scale);
+  }
+  dstStops->back() = dstEnd;
+  return true;
+}
+
+void Canvas::drawImageLattice(std::shared_ptr<Image> image, const Lattice& lattice,
+                              const Rect& dst, FilterMode filterMode, const Paint* paint) {
+  if (image == nullptr || dst.isEmpty() || (paint && paint->nothingToDraw())) {
+    return;
+  }
+  if (paint && paint->getImageFilter()) {
+    // The image filter applies to the stretched result, so draw the lattice into a layer first.
+    Recorder recorder = {};
+    auto canvas = recorder.beginRecording();
+    canvas->drawImageLattice(std::move(image), lattice, dst, filterMode, nullptr);
+    drawPicture(recorder.finishRecordingAsPicture(), nullptr, paint);
+    return;
+  }
+  auto bounds = Rect::MakeWH(image->width(), image->height());
+  if (lattice.bounds != nullptr && !bounds.intersect(*lattice.bounds)) {
+    return;
+  }
+  std::vector<float> srcX = {};
+  std::vector<float> dstX = {};
+  std::vector<float> srcY = {};
+  std::vector<float> dstY = {};
+  if (!ComputeLatticeStops(lattice.xDivs, lattice.xCount, bounds.left, bounds.right, dst.left,
+                           dst.right, &srcX, &dstX) ||
+      !ComputeLatticeStops(lattice.yDivs, lattice.yCount, bounds.top, bounds.bottom, dst.top,
+                           dst.bottom, &srcY, &dstY)) {
+    LOGE("Canvas::drawImageLattice() The lattice is invalid!");
+    return;
+  }
+  std::vector<ImagePatch> patches = {};
+  patches.reserve((srcX.size() - 1) * (srcY.size() - 1));
+  for (size_t row = 0; row + 1 < srcY.size(); row++) {
+    for (size_t column = 0; column + 1 < srcX.size(); column++) {
+      ImagePatch patch = {};
+      patch.src.setLTRB(srcX[column], srcY[row], srcX[column + 1], srcY[row + 1]);
+      patch.dst.setLTRB(dstX[column], dstY[row], dstX[column + 1], dstY[row + 1]);
+      if (!patch.src.isEmpty() && !patch.dst.isEmpty()) {
+        patches.push_back(patch);
+      }
+    }
+  }
+  if (patches.empty()) {
+    return;
+  }
+  auto style = CreateFillStyle(paint);
+  SamplingOptions sampling(filterMode);
+  drawContext->drawImagePatches(std::move(image), sampling, patches, *mcState, style);
+}
+
 void Canvas::drawSimpleText(const std::string& text, float x, float y, const Font& font,
                             const Paint& paint) {
   if (text.empty() || paint.nothingToDraw()) {
@@ -362,6 +646,10 @@ void Canvas::drawPicture(std::shared_ptr<Picture> picture, const Matrix* matrix,
 
 void Canvas::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
                        const FillStyle& style, std::shared_ptr<ImageFilter> filter) {
+  if (filter == nullptr && LayerUnrollContext::IsLayerUnneeded(picture.get(), style)) {
+    drawContext->drawPicture(std::move(picture), state);
+    return;
+  }
   if (picture->records.size() == 1) {
     LayerUnrollContext layerContext(drawContext, style, filter);
     picture->playback(&layerContext, state);
@@ -372,6 +660,14 @@ void Canvas::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
   drawContext->drawLayer(std::move(picture), state, style, std::move(filter));
 }
 
+void Canvas::drawVertices(std::shared_ptr<Vertices> vertices, const Paint& paint) {
+  if (vertices == nullptr || paint.nothingToDraw()) {
+    return;
+  }
+  auto style = CreateFillStyle(paint);
+  drawContext->drawVertices(std::move(vertices), *mcState, style);
+}
+
 void Canvas::drawAtlas(std::shared_ptr<Image> atlas, const Matrix matrix[], const Rect tex[],
                        const Color colors[], size_t count, const SamplingOptions& sampling,
                        const Paint* paint) {
@@ -20,6 +20,40 @@
 #include "tgfx/core/Picture.h"
 
 namespace tgfx {
+void DrawContext::drawRects(const std::vector<Rect>& rects, const MCState& state,
+                            const FillStyle& style) {
+  for (auto& rect : rects) {
+    drawRect(rect, state, style);
+  }
+}
+
+void DrawContext::drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                             const FillStyle& style) {
+  for (auto& rRect : rRects) {
+    drawRRect(rRect, state, style);
+  }
+}
+
+void DrawContext::drawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                                   const std::vector<ImagePatch>& patches, const MCState& state,
+                                   const FillStyle& style) {
+  auto patchState = state;
+  for (auto& patch : patches) {
+    auto scaleX = patch.dst.width() / patch.src.width();
+    auto scaleY = patch.dst.height() / patch.src.height();
+    auto matrix = Matrix::MakeAll(scaleX, 0, patch.dst.left - patch.src.left * scaleX, 0, scaleY,
+                                  patch.dst.top - patch.src.top * scaleY);
+    patchState.matrix = state.matrix * matrix;
+    auto patchStyle = style;
+    Matrix invertMatrix = {};
+    if (style.shader && matrix.invert(&invertMatrix)) {
+      // Keeps the shader in the destination space of the patches.
+      patchStyle.shader = style.shader->makeWithMatrix(invertMatrix);
+    }
+    drawImageRect(image, sampling, patch.src, patchState, patchStyle);
+  }
+}
+
 void DrawContext::drawPicture(std::shared_ptr<Picture> picture, const MCState& state) {
   if (picture != nullptr) {
     picture->playback(this, state);
@@ -21,10 +21,12 @@
 #include <stack>
 #include "core/FillStyle.h"
 #include "core/GlyphRun.h"
+#include "core/ImagePatch.h"
 #include "core/MCState.h"
 #include "tgfx/core/Matrix.h"
 #include "tgfx/core/Path.h"
 #include "tgfx/core/Picture.h"
+#include "tgfx/core/Vertices.h"
 
 namespace tgfx {
 class Surface;
@@ -59,6 +61,20 @@ class DrawContext {
    */
   virtual void drawRRect(const RRect& rRect, const MCState& state, const FillStyle& style) = 0;
 
+  /**
+   * Draws a list of rectangles sharing the same MCState and FillStyle. The default implementation
+   * draws each rectangle individually.
+   */
+  virtual void drawRects(const std::vector<Rect>& rects, const MCState& state,
+                         const FillStyle& style);
+
+  /**
+   * Draws a list of rounded rectangles sharing the same MCState and FillStyle. The default
+   * implementation draws each rounded rectangle individually.
+   */
+  virtual void drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                          const FillStyle& style);
+
   /**
    * Draws a complex Path with the specified FillStyle and optional Stroke.
    */
@@ -71,12 +87,26 @@ class DrawContext {
   virtual void drawImageRect(std::shared_ptr<Image> image, const SamplingOptions& sampling,
                              const Rect& rect, const MCState& state, const FillStyle& style) = 0;
 
+  /**
+   * Draws a list of non-overlapping patches of the Image, each mapping a source rectangle of the
+   * image to a destination rectangle. The default implementation draws each patch individually.
+   */
+  virtual void drawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                                const std::vector<ImagePatch>& patches, const MCState& state,
+                                const FillStyle& style);
+
   /**
    * Draws a GlyphRun with the specified FillStyle and optional Stroke.
    */
   virtual void drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                             const Stroke* stroke) = 0;
 
+  /**
+   * Draws a triangle mesh with the specified FillStyle.
+   */
+  virtual void drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                            const FillStyle& style) = 0;
+
   /**
    * Draws a Picture into an offscreen layer. This offscreen layer is then passed to the image
    * filter (if not nullptr), which generates a new image. This new image is finally drawn using the
@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "HitTestContext.h"
+#include "tgfx/core/PathEffect.h"
+
+namespace tgfx {
+void HitTestContext::clear() {
+  // Clearing only makes pixels transparent, it never adds coverage.
+}
+
+void HitTestContext::drawRect(const Rect& rect, const MCState& state, const FillStyle&) {
+  Point local = {};
+  if (checkState(state, &local) && rect.contains(local.x, local.y)) {
+    hit = true;
+  }
+}
+
+void HitTestContext::drawRRect(const RRect& rRect, const MCState& state, const FillStyle&) {
+  Point local = {};
+  if (!checkState(state, &local) || !rRect.rect.contains(local.x, local.y)) {
+    return;
+  }
+  Path path = {};
+  path.addRRect(rRect);
+  if (path.contains(local.x, local.y)) {
+    hit = true;
+  }
+}
+
+void HitTestContext::drawPath(const Path& path, const MCState& state, const FillStyle&,
+                              const Stroke* stroke) {
+  Point local = {};
+  if (!checkState(state, &local)) {
+    return;
+  }
+  if (stroke == nullptr) {
+    hit = path.contains(local.x, local.y);
+    return;
+  }
+  auto bounds = path.getBounds();
+  bounds.outset(stroke->width, stroke->width);
+  if (!bounds.contains(local.x, local.y)) {
+    return;
+  }
+  auto strokePath = path;
+  auto effect = PathEffect::MakeStroke(stroke);
+  if (effect == nullptr || !effect->applyTo(&strokePath)) {
+    hit = true;
+    return;
+  }
+  hit = strokePath.contains(local.x, local.y);
+}
+
+void HitTestContext::drawImageRect(std::shared_ptr<Image>, const SamplingOptions&,
+                                   const Rect& rect, const MCState& state, const FillStyle&) {
+  // The pixels of an image may live on the GPU only, so images are treated as opaque rectangles.
+  drawRect(rect, state, {});
+}
+
+void HitTestContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle&,
+                                  const Stroke* stroke) {
+  Point local = {};
+  if (!checkState(state, &local)) {
+    return;
+  }
+  auto bounds = glyphRun.getBounds(Matrix::I(), stroke);
+  if (!bounds.contains(local.x, local.y)) {
+    return;
+  }
+  if (!glyphRun.hasColor()) {
+    Path path = {};
+    if (glyphRun.getPath(&path, Matrix::I(), stroke)) {
+      hit = path.contains(local.x, local.y);
+      return;
+    }
+  }
+  // Color glyphs have no outlines, fall back to the bounds of each glyph.
+  auto& font = glyphRun.font();
+  auto& glyphIDs = glyphRun.glyphIDs();
+  auto& positions = glyphRun.positions();
+  for (size_t i = 0; i < glyphIDs.size(); i++) {
+    auto glyphBounds = font.getBounds(glyphIDs[i]);
+    glyphBounds.offset(positions[i].x, positions[i].y);
+    if (glyphBounds.contains(local.x, local.y)) {
+      hit = true;
+      return;
+    }
+  }
+}
+
+static bool TriangleContains(const Point& a, const Point& b, const Point& c, const Point& p) {
+  auto d1 = (p.x - b.x) * (a.y - b.y) - (a.x - b.x) * (p.y - b.y);
+  auto d2 = (p.x - c.x) * (b.y - c.y) - (b.x - c.x) * (p.y - c.y);
+  auto d3 = (p.x - a.x) * (c.y - a.y) - (c.x - a.x) * (p.y - a.y);
+  auto hasNegative = d1 < 0 || d2 < 0 || d3 < 0;
+  auto hasPositive = d1 > 0 || d2 > 0 || d3 > 0;
+  return !(hasNegative && hasPositive);
+}
+
+void HitTestContext::drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                                  const FillStyle&) {
+  Point local = {};
+  if (!checkState(state, &local) || !vertices->bounds().contains(local.x, local.y)) {
+    return;
+  }
+  auto& positions = vertices->positions();
+  auto& indices = vertices->indices();
+  auto count = indices.empty() ? positions.size() : indices.size();
+  for (size_t i = 0; i + 2 < count; i += 3) {
+    auto& a = positions[indices.empty() ? i : indices[i]];
+    auto& b = positions[indices.empty() ? i + 1 : indices[i + 1]];
+    auto& c = positions[indices.empty() ? i + 2 : indices[i + 2]];
+    if (TriangleContains(a, b, c, local)) {
+      hit = true;
+      return;
+    }
+  }
+}
+
+void HitTestContext::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
+                               const FillStyle&, std::shared_ptr<ImageFilter> filter) {
+  if (picture == nullptr || hit) {
+    return;
+  }
+  if (filter == nullptr) {
+    drawPicture(std::move(picture), state);
+    return;
+  }
+  Point local = {};
+  if (!checkState(state, &local)) {
+    return;
+  }
+  // The filter may move or spread the content, so test against the filtered bounds instead.
+  auto bounds = filter->filterBounds(picture->getBounds());
+  if (bounds.contains(local.x, local.y)) {
+    hit = true;
+  }
+}
+
+void HitTestContext::drawPicture(std::shared_ptr<Picture> picture, const MCState& state) {
+  Point local = {};
+  if (picture == nullptr || !checkState(state, &local)) {
+    return;
+  }
+  hit = picture->hitTest(local.x, local.y);
+}
+
+bool HitTestContext::checkState(const MCState& state, Point* localPoint) const {
+  if (hit) {
+    return false;
+  }
+  if (!state.clip.isEmpty() || !state.clip.isInverseFillType()) {
+    if (!state.clip.contains(x, y)) {
+      return false;
+    }
+  }
+  Matrix inverse = {};
+  if (!state.matrix.invert(&inverse)) {
+    return false;
+  }
+  *localPoint = inverse.mapXY(x, y);
+  return true;
+}
+}  // namespace tgfx
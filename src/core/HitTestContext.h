@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "core/DrawContext.h"
+
+namespace tgfx {
+/**
+ * HitTestContext evaluates on the CPU whether any of the drawings sent to it covers a given point.
+ * The point is in the same coordinate space as the MCState passed to each drawing call.
+ */
+class HitTestContext : public DrawContext {
+ public:
+  HitTestContext(float x, float y) : x(x), y(y) {
+  }
+
+  /**
+   * Returns true if any of the drawings so far covers the point.
+   */
+  bool hasHit() const {
+    return hit;
+  }
+
+  void clear() override;
+
+  void drawRect(const Rect& rect, const MCState& state, const FillStyle& style) override;
+
+  void drawRRect(const RRect& rRect, const MCState& state, const FillStyle& style) override;
+
+  void drawPath(const Path& path, const MCState& state, const FillStyle& style,
+                const Stroke* stroke) override;
+
+  void drawImageRect(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                     const Rect& rect, const MCState& state, const FillStyle& style) override;
+
+  void drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
+                    const Stroke* stroke) override;
+
+  void drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                    const FillStyle& style) override;
+
+  void drawLayer(std::shared_ptr<Picture> picture, const MCState& state, const FillStyle& style,
+                 std::shared_ptr<ImageFilter> filter) override;
+
+  void drawPicture(std::shared_ptr<Picture> picture, const MCState& state) override;
+
+ private:
+  float x = 0;
+  float y = 0;
+  bool hit = false;
+
+  /**
+   * Returns true if the point is inside the clip and the drawing is worth testing any further. If
+   * so, localPoint is set to the point mapped into the local coordinate space of the state.
+   */
+  bool checkState(const MCState& state, Point* localPoint) const;
+};
+}  // namespace tgfx
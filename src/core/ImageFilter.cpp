@@ -22,18 +22,23 @@
 #include "gpu/processors/FragmentProcessor.h"
 
 namespace tgfx {
-Rect ImageFilter::filterBounds(const Rect& rect) const {
+Rect ImageFilter::filterBounds(const Rect& rect, MapDirection mapDirection) const {
+  if (mapDirection == MapDirection::Reverse) {
+    auto srcBounds = onFilterBounds(rect, MapDirection::Reverse);
+    srcBounds.roundOut();
+    return srcBounds;
+  }
   auto dstBounds = Rect::MakeEmpty();
   applyCropRect(rect, &dstBounds);
   return dstBounds;
 }
 
-Rect ImageFilter::onFilterBounds(const Rect& srcRect) const {
-  return srcRect;
+Rect ImageFilter::onFilterBounds(const Rect& rect, MapDirection) const {
+  return rect;
 }
 
 bool ImageFilter::applyCropRect(const Rect& srcRect, Rect* dstRect, const Rect* clipBounds) const {
-  *dstRect = onFilterBounds(srcRect);
+  *dstRect = onFilterBounds(srcRect, MapDirection::Forward);
   if (clipBounds) {
     if (!dstRect->intersect(*clipBounds)) {
       return false;
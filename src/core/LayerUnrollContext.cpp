@@ -23,6 +23,69 @@
 namespace tgfx {
 using namespace pk;
 
+/**
+ * A DrawContext that checks whether all the draws it receives blend with BlendMode::SrcOver.
+ */
+class SrcOverCheckContext : public DrawContext {
+ public:
+  bool allSrcOver() const {
+    return srcOver;
+  }
+
+  void clear() override {
+    srcOver = false;
+  }
+
+  void drawRect(const Rect&, const MCState&, const FillStyle& style) override {
+    check(style);
+  }
+
+  void drawRRect(const RRect&, const MCState&, const FillStyle& style) override {
+    check(style);
+  }
+
+  void drawPath(const Path&, const MCState&, const FillStyle& style, const Stroke*) override {
+    check(style);
+  }
+
+  void drawImageRect(std::shared_ptr<Image>, const SamplingOptions&, const Rect&, const MCState&,
+                     const FillStyle& style) override {
+    check(style);
+  }
+
+  void drawGlyphRun(GlyphRun, const MCState&, const FillStyle& style, const Stroke*) override {
+    check(style);
+  }
+
+  void drawVertices(std::shared_ptr<Vertices>, const MCState&, const FillStyle& style) override {
+    check(style);
+  }
+
+  void drawLayer(std::shared_ptr<Picture>, const MCState&, const FillStyle& style,
+                 std::shared_ptr<ImageFilter>) override {
+    check(style);
+  }
+
+ private:
+  bool srcOver = true;
+
+  void check(const FillStyle& style) {
+    if (style.blendMode != BlendMode::SrcOver) {
+      srcOver = false;
+    }
+  }
+};
+
+bool LayerUnrollContext::IsLayerUnneeded(const Picture* picture, const FillStyle& style) {
+  if (style.blendMode != BlendMode::SrcOver || style.color.alpha != 1.0f || style.shader ||
+      style.colorFilter || style.maskFilter) {
+    return false;
+  }
+  SrcOverCheckContext checkContext = {};
+  picture->playback(&checkContext, {});
+  return checkContext.allSrcOver();
+}
+
 LayerUnrollContext::LayerUnrollContext(DrawContext* drawContext, FillStyle fillStyle,
                                        std::shared_ptr<ImageFilter> filter)
     : drawContext(drawContext), fillStyle(std::move(fillStyle)), imageFilter(std::move(filter)) {
@@ -46,6 +109,14 @@ void LayerUnrollContext::drawRRect(const RRect& rRect, const MCState& state,
   }
 }
 
+void LayerUnrollContext::drawRects(const std::vector<Rect>&, const MCState&, const FillStyle&) {
+  // The rectangles in the list may overlap each other, so we can't unroll them.
+}
+
+void LayerUnrollContext::drawRRects(const std::vector<RRect>&, const MCState&, const FillStyle&) {
+  // The rounded rectangles in the list may overlap each other, so we can't unroll them.
+}
+
 void LayerUnrollContext::drawPath(const Path& path, const MCState& state, const FillStyle& style,
                                   const Stroke* stroke) {
   if (imageFilter) {
@@ -80,6 +151,17 @@ void LayerUnrollContext::drawImageRect(std::shared_ptr<Image> image,
   unrolled = true;
 }
 
+void LayerUnrollContext::drawImagePatches(std::shared_ptr<Image> image,
+                                          const SamplingOptions& sampling,
+                                          const std::vector<ImagePatch>& patches,
+                                          const MCState& state, const FillStyle& style) {
+  if (!imageFilter) {
+    // The patches never overlap each other.
+    drawContext->drawImagePatches(std::move(image), sampling, patches, state, merge(style));
+    unrolled = true;
+  }
+}
+
 void LayerUnrollContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state,
                                       const FillStyle& style, const Stroke* stroke) {
   if (!imageFilter) {
@@ -89,6 +171,11 @@ void LayerUnrollContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state,
   }
 }
 
+void LayerUnrollContext::drawVertices(std::shared_ptr<Vertices>, const MCState&,
+                                      const FillStyle&) {
+  // The triangles of a mesh may overlap each other, so we can't unroll it.
+}
+
 void LayerUnrollContext::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
                                    const FillStyle& style, std::shared_ptr<ImageFilter> filter) {
   filter = ImageFilter::Compose(filter, imageFilter);
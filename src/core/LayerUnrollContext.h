@@ -23,6 +23,14 @@
 namespace tgfx {
 class LayerUnrollContext : public DrawContext {
  public:
+  /**
+   * Returns true if drawing the picture into an offscreen layer and then compositing that layer
+   * with the given style produces the same result as drawing the picture directly. This is the case
+   * when the style leaves the layer unchanged and every draw inside the picture blends with
+   * BlendMode::SrcOver, which is associative.
+   */
+  static bool IsLayerUnneeded(const Picture* picture, const FillStyle& style);
+
   explicit LayerUnrollContext(DrawContext* drawContext, FillStyle fillStyle,
                               std::shared_ptr<ImageFilter> filter);
 
@@ -36,15 +44,28 @@ class LayerUnrollContext : public DrawContext {
 
   void drawRRect(const RRect& rRect, const MCState& state, const FillStyle& style) override;
 
+  void drawRects(const std::vector<Rect>& rects, const MCState& state,
+                 const FillStyle& style) override;
+
+  void drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                  const FillStyle& style) override;
+
   void drawPath(const Path& path, const MCState& state, const FillStyle& style,
                 const Stroke* stroke) override;
 
   void drawImageRect(std::shared_ptr<Image> image, const SamplingOptions& sampling,
                      const Rect& rect, const MCState& mcState, const FillStyle& style) override;
 
+  void drawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                        const std::vector<ImagePatch>& patches, const MCState& state,
+                        const FillStyle& style) override;
+
   void drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                     const Stroke* stroke) override;
 
+  void drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                    const FillStyle& style) override;
+
   void drawLayer(std::shared_ptr<Picture> picture, const MCState& state, const FillStyle& style,
                  std::shared_ptr<ImageFilter> filter) override;
 
@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MaskTileGrid.h"
+#include <cmath>
+
+namespace tgfx {
+// The distance in pixels that antialiasing may spread the coverage of an edge.
+static constexpr float EDGE_MARGIN = 1.0f;
+// The maximum length of the control polygon of a curve piece after flattening.
+static constexpr float CURVE_PIECE_LENGTH = 8.0f;
+static constexpr int MAX_PIECE_COUNT = 4096;
+
+MaskTileGrid::MaskTileGrid(const Path& path, int width, int height, int tileSize)
+    : width(width), height(height), tileSize(tileSize) {
+  _columns = (width + tileSize - 1) / tileSize;
+  _rows = (height + tileSize - 1) / tileSize;
+  tiles.resize(static_cast<size_t>(_columns * _rows), TileCoverage::None);
+  Point startPoint = Point::Zero();
+  Point lastPoint = Point::Zero();
+  path.decompose([&](PathVerb verb, const Point points[4], void*) {
+    switch (verb) {
+      case PathVerb::Move:
+        if (lastPoint != startPoint) {
+          // Filled contours are closed implicitly.
+          Point line[] = {lastPoint, startPoint};
+          markSegment(line, 2);
+        }
+        startPoint = lastPoint = points[0];
+        break;
+      case PathVerb::Line:
+        markSegment(points, 2);
+        lastPoint = points[1];
+        break;
+      case PathVerb::Quad:
+        markSegment(points, 3);
+        lastPoint = points[2];
+        break;
+      case PathVerb::Cubic:
+        markSegment(points, 4);
+        lastPoint = points[3];
+        break;
+      case PathVerb::Close:
+        break;
+    }
+  });
+  if (lastPoint != startPoint) {
+    Point line[] = {lastPoint, startPoint};
+    markSegment(line, 2);
+  }
+  for (int row = 0; row < _rows; row++) {
+    for (int column = 0; column < _columns; column++) {
+      auto& tile = tiles[static_cast<size_t>(row * _columns + column)];
+      if (tile == TileCoverage::Partial) {
+        continue;
+      }
+      auto rect = getTileRect(column, row);
+      if (path.contains(rect.centerX(), rect.centerY())) {
+        tile = TileCoverage::Full;
+      }
+    }
+  }
+}
+
+Rect MaskTileGrid::getTileRect(int column, int row) const {
+  auto left = column * tileSize;
+  auto top = row * tileSize;
+  auto right = std::min(left + tileSize, width);
+  auto bottom = std::min(top + tileSize, height);
+  return Rect::MakeLTRB(static_cast<float>(left), static_cast<float>(top),
+                        static_cast<float>(right), static_cast<float>(bottom));
+}
+
+void MaskTileGrid::markRect(const Rect& rect) {
+  auto size = static_cast<float>(tileSize);
+  auto left = std::max(static_cast<int>(floorf(rect.left / size)), 0);
+  auto top = std::max(static_cast<int>(floorf(rect.top / size)), 0);
+  auto right = std::min(static_cast<int>(floorf(rect.right / size)), _columns - 1);
+  auto bottom = std::min(static_cast<int>(floorf(rect.bottom / size)), _rows - 1);
+  for (int row = top; row <= bottom; row++) {
+    for (int column = left; column <= right; column++) {
+      tiles[static_cast<size_t>(row * _columns + column)] = TileCoverage::Partial;
+    }
+  }
+}
+
+static Point Evaluate(const Point points[], int count, float t) {
+  auto s = 1.0f - t;
+  float weights[4] = {};
+  if (count == 2) {
+    weights[0] = s;
+    weights[1] = t;
+  } else if (count == 3) {
+    weights[0] = s * s;
+    weights[1] = 2 * s * t;
+    weights[2] = t * t;
+  } else {
+    weights[0] = s * s * s;
+    weights[1] = 3 * s * s * t;
+    weights[2] = 3 * s * t * t;
+    weights[3] = t * t * t;
+  }
+  Point result = Point::Zero();
+  for (int i = 0; i < count; i++) {
+    result.x += points[i].x * weights[i];
+    result.y += points[i].y * weights[i];
+  }
+  return result;
+}
+
+void MaskTileGrid::markSegment(const Point points[], int count) {
+  float polygonLength = 0;
+  for (int i = 1; i < count; i++) {
+    polygonLength += Point::Distance(points[i - 1], points[i]);
+  }
+  // Lines are split into pieces no longer than half a tile, so each piece only marks the tiles it
+  // actually passes through. Curves are flattened into pieces that stay within CURVE_PIECE_LENGTH
+  // of their chords, which is added to the margin.
+  auto pieceLength = count == 2 ? static_cast<float>(tileSize) * 0.5f : CURVE_PIECE_LENGTH;
+  auto pieceCount = static_cast<int>(ceilf(polygonLength / pieceLength));
+  pieceCount = std::clamp(pieceCount, 1, MAX_PIECE_COUNT);
+  auto margin = EDGE_MARGIN;
+  if (count > 2) {
+    margin += polygonLength / static_cast<float>(pieceCount);
+  }
+  auto lastPoint = points[0];
+  for (int i = 1; i <= pieceCount; i++) {
+    auto t = static_cast<float>(i) / static_cast<float>(pieceCount);
+    auto point = Evaluate(points, count, t);
+    auto rect = Rect::MakeLTRB(std::min(lastPoint.x, point.x), std::min(lastPoint.y, point.y),
+                               std::max(lastPoint.x, point.x), std::max(lastPoint.y, point.y));
+    rect.outset(margin, margin);
+    markRect(rect);
+    lastPoint = point;
+  }
+}
+}  // namespace tgfx
@@ -0,0 +1,88 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include "tgfx/core/Path.h"
+
+namespace tgfx {
+/**
+ * Describes how much of a tile is covered by a path.
+ */
+enum class TileCoverage : uint8_t {
+  /**
+   * The tile lies entirely outside the path.
+   */
+  None,
+  /**
+   * The tile is crossed by at least one edge of the path.
+   */
+  Partial,
+  /**
+   * The tile lies entirely inside the path.
+   */
+  Full
+};
+
+/**
+ * MaskTileGrid splits the area of a mask into square tiles and classifies each tile by its coverage
+ * of a filled path. Only the tiles crossed by the edges of the path need to be rasterized, tiles
+ * without edges are either entirely inside or entirely outside the path. The classification is
+ * conservative: a tile near an edge may be reported as Partial even if the edge misses it.
+ */
+class MaskTileGrid {
+ public:
+  /**
+   * Creates a MaskTileGrid for the given path, which must be a filled path in the coordinate space
+   * of the mask.
+   */
+  MaskTileGrid(const Path& path, int width, int height, int tileSize);
+
+  int columns() const {
+    return _columns;
+  }
+
+  int rows() const {
+    return _rows;
+  }
+
+  /**
+   * Returns the coverage of the tile at the given column and row.
+   */
+  TileCoverage coverage(int column, int row) const {
+    return tiles[static_cast<size_t>(row * _columns + column)];
+  }
+
+  /**
+   * Returns the bounds of the tile at the given column and row, clipped to the size of the mask.
+   */
+  Rect getTileRect(int column, int row) const;
+
+ private:
+  int width = 0;
+  int height = 0;
+  int tileSize = 0;
+  int _columns = 0;
+  int _rows = 0;
+  std::vector<TileCoverage> tiles = {};
+
+  void markRect(const Rect& rect);
+  void markSegment(const Point points[], int count);
+};
+}  // namespace tgfx
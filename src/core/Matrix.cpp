@@ -20,6 +20,14 @@
 #include <cfloat>
 #include "utils/MathExtra.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TGFX_MATRIX_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define TGFX_MATRIX_NEON
+#endif
+
 namespace tgfx {
 
 void Matrix::reset() {
@@ -333,6 +341,121 @@ bool Matrix::invertNonIdentity(Matrix* inverse) const {
   return true;
 }
 
+/**
+ * The vector kernels below process two points per register, which relies on Point being two
+ * tightly packed floats.
+ */
+static_assert(sizeof(Point) == 2 * sizeof(float), "Point must be two packed floats");
+
+#if defined(TGFX_MATRIX_SSE2)
+#define TGFX_MATRIX_SIMD
+using PointPair = __m128;
+
+static inline PointPair LoadPointPair(const Point* points) {
+  return _mm_loadu_ps(&points->x);
+}
+
+static inline void StorePointPair(Point* points, PointPair value) {
+  _mm_storeu_ps(&points->x, value);
+}
+
+static inline PointPair MakePointPair(float x, float y) {
+  return _mm_setr_ps(x, y, x, y);
+}
+
+static inline PointPair AddPointPair(PointPair a, PointPair b) {
+  return _mm_add_ps(a, b);
+}
+
+static inline PointPair MulPointPair(PointPair a, PointPair b) {
+  return _mm_mul_ps(a, b);
+}
+
+static inline PointPair SwapPointPairXY(PointPair value) {
+  return _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1));
+}
+#elif defined(TGFX_MATRIX_NEON)
+#define TGFX_MATRIX_SIMD
+using PointPair = float32x4_t;
+
+static inline PointPair LoadPointPair(const Point* points) {
+  return vld1q_f32(&points->x);
+}
+
+static inline void StorePointPair(Point* points, PointPair value) {
+  vst1q_f32(&points->x, value);
+}
+
+static inline PointPair MakePointPair(float x, float y) {
+  float values[4] = {x, y, x, y};
+  return vld1q_f32(values);
+}
+
+static inline PointPair AddPointPair(PointPair a, PointPair b) {
+  return vaddq_f32(a, b);
+}
+
+static inline PointPair MulPointPair(PointPair a, PointPair b) {
+  return vmulq_f32(a, b);
+}
+
+static inline PointPair SwapPointPairXY(PointPair value) {
+  return vrev64q_f32(value);
+}
+#endif
+
+static void TranslatePoints(Point dst[], const Point src[], int count, float tx, float ty) {
+  int i = 0;
+#ifdef TGFX_MATRIX_SIMD
+  auto trans = MakePointPair(tx, ty);
+  for (; i + 2 <= count; i += 2) {
+    StorePointPair(dst + i, AddPointPair(LoadPointPair(src + i), trans));
+  }
+#endif
+  for (; i < count; i++) {
+    dst[i].set(src[i].x + tx, src[i].y + ty);
+  }
+}
+
+static void ScaleTranslatePoints(Point dst[], const Point src[], int count, float sx, float sy,
+                                 float tx, float ty) {
+  int i = 0;
+#ifdef TGFX_MATRIX_SIMD
+  auto scale = MakePointPair(sx, sy);
+  auto trans = MakePointPair(tx, ty);
+  for (; i + 2 <= count; i += 2) {
+    auto points = LoadPointPair(src + i);
+    StorePointPair(dst + i, AddPointPair(MulPointPair(points, scale), trans));
+  }
+#endif
+  for (; i < count; i++) {
+    dst[i].set(src[i].x * sx + tx, src[i].y * sy + ty);
+  }
+}
+
+static void AffinePoints(Point dst[], const Point src[], int count, float sx, float kx, float tx,
+                         float ky, float sy, float ty) {
+  int i = 0;
+#ifdef TGFX_MATRIX_SIMD
+  // x' = x * sx + y * kx + tx and y' = y * sy + x * ky + ty, so the skew terms multiply the points
+  // with their x and y swapped.
+  auto scale = MakePointPair(sx, sy);
+  auto skew = MakePointPair(kx, ky);
+  auto trans = MakePointPair(tx, ty);
+  for (; i + 2 <= count; i += 2) {
+    auto points = LoadPointPair(src + i);
+    auto scaled = MulPointPair(points, scale);
+    auto skewed = MulPointPair(SwapPointPairXY(points), skew);
+    StorePointPair(dst + i, AddPointPair(AddPointPair(scaled, skewed), trans));
+  }
+#endif
+  for (; i < count; i++) {
+    auto x = src[i].x * sx + src[i].y * kx + tx;
+    auto y = src[i].x * ky + src[i].y * sy + ty;
+    dst[i].set(x, y);
+  }
+}
+
 void Matrix::mapPoints(Point dst[], const Point src[], int count) const {
   auto tx = values[TRANS_X];
   auto ty = values[TRANS_Y];
@@ -340,10 +463,14 @@ void Matrix::mapPoints(Point dst[], const Point src[], int count) const {
   auto sy = values[SCALE_Y];
   auto kx = values[SKEW_X];
   auto ky = values[SKEW_Y];
-  for (int i = 0; i < count; i++) {
-    auto x = src[i].x * sx + src[i].y * kx + tx;
-    auto y = src[i].x * ky + src[i].y * sy + ty;
-    dst[i].set(x, y);
+  if (kx != 0 || ky != 0) {
+    AffinePoints(dst, src, count, sx, kx, tx, ky, sy, ty);
+  } else if (sx != 1 || sy != 1) {
+    ScaleTranslatePoints(dst, src, count, sx, sy, tx, ty);
+  } else if (tx != 0 || ty != 0) {
+    TranslatePoints(dst, src, count, tx, ty);
+  } else if (dst != src && count > 0) {
+    memcpy(dst, src, static_cast<size_t>(count) * sizeof(Point));
   }
 }
 
@@ -370,6 +497,15 @@ bool Matrix::rectStaysRect() const {
 }
 
 void Matrix::mapRect(Rect* dst, const Rect& src) const {
+  if (values[SKEW_X] == 0 && values[SKEW_Y] == 0) {
+    // Without skew the mapped rect stays axis-aligned, so two opposite corners are enough.
+    Point corners[2];
+    corners[0].set(src.left, src.top);
+    corners[1].set(src.right, src.bottom);
+    mapPoints(corners, corners, 2);
+    dst->setBounds(corners, 2);
+    return;
+  }
   Point quad[4];
   quad[0].set(src.left, src.top);
   quad[1].set(src.right, src.top);
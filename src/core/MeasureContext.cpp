@@ -31,6 +31,24 @@ void MeasureContext::drawRRect(const RRect& rRect, const MCState& state, const F
   addLocalBounds(rRect.rect, state);
 }
 
+void MeasureContext::drawRects(const std::vector<Rect>& rects, const MCState& state,
+                               const FillStyle&) {
+  auto localBounds = Rect::MakeEmpty();
+  for (auto& rect : rects) {
+    localBounds.join(rect);
+  }
+  addLocalBounds(localBounds, state);
+}
+
+void MeasureContext::drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                                const FillStyle&) {
+  auto localBounds = Rect::MakeEmpty();
+  for (auto& rRect : rRects) {
+    localBounds.join(rRect.rect);
+  }
+  addLocalBounds(localBounds, state);
+}
+
 void MeasureContext::drawPath(const Path& path, const MCState& state, const FillStyle&,
                               const Stroke* stroke) {
   auto pathBounds = path.getBounds();
@@ -45,12 +63,27 @@ void MeasureContext::drawImageRect(std::shared_ptr<Image>, const SamplingOptions
   addLocalBounds(rect, state);
 }
 
+void MeasureContext::drawImagePatches(std::shared_ptr<Image>, const SamplingOptions&,
+                                      const std::vector<ImagePatch>& patches,
+                                      const MCState& state, const FillStyle&) {
+  auto localBounds = Rect::MakeEmpty();
+  for (auto& patch : patches) {
+    localBounds.join(patch.dst);
+  }
+  addLocalBounds(localBounds, state);
+}
+
 void MeasureContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle&,
                                   const Stroke* stroke) {
   auto deviceBounds = glyphRun.getBounds(state.matrix, stroke);
   addDeviceBounds(deviceBounds, state.clip);
 }
 
+void MeasureContext::drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                                  const FillStyle&) {
+  addLocalBounds(vertices->bounds(), state);
+}
+
 void MeasureContext::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
                                const FillStyle&, std::shared_ptr<ImageFilter> imageFilter) {
   if (picture == nullptr) {
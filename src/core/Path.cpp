@@ -125,43 +125,46 @@ void Path::toggleInverseFillType() {
 }
 
 bool Path::isLine(Point line[2]) const {
-  return pathRef->path.isLine(reinterpret_cast<SkPoint*>(line));
+  auto& analysis = pathRef->getAnalysis();
+  if (analysis.shape != PathShape::Line) {
+    return false;
+  }
+  if (line) {
+    line[0] = analysis.line[0];
+    line[1] = analysis.line[1];
+  }
+  return true;
 }
 
 bool Path::isRect(Rect* rect) const {
-  if (!rect) {
-    return pathRef->path.isRect(nullptr);
-  }
-  SkRect skRect = {};
-  if (!pathRef->path.isRect(&skRect)) {
+  auto& analysis = pathRef->getAnalysis();
+  if (analysis.shape != PathShape::Rect) {
     return false;
   }
-  rect->setLTRB(skRect.fLeft, skRect.fTop, skRect.fRight, skRect.fBottom);
+  if (rect) {
+    *rect = analysis.rRect.rect;
+  }
   return true;
 }
 
 bool Path::isOval(Rect* bounds) const {
-  if (!bounds) {
-    return pathRef->path.isOval(nullptr);
-  }
-  SkRect skRect = {};
-  if (!pathRef->path.isOval(&skRect)) {
+  auto& analysis = pathRef->getAnalysis();
+  if (analysis.shape != PathShape::Oval) {
     return false;
   }
-  bounds->setLTRB(skRect.fLeft, skRect.fTop, skRect.fRight, skRect.fBottom);
+  if (bounds) {
+    *bounds = analysis.rRect.rect;
+  }
   return true;
 }
 
 bool Path::isRRect(RRect* rRect) const {
-  SkRRect skRRect = {};
-  if (!pathRef->path.isRRect(&skRRect) || !skRRect.isSimple()) {
+  auto& analysis = pathRef->getAnalysis();
+  if (analysis.shape != PathShape::RRect) {
     return false;
   }
   if (rRect) {
-    const auto& rect = skRRect.rect();
-    rRect->rect.setLTRB(rect.fLeft, rect.fTop, rect.fRight, rect.fBottom);
-    auto radii = skRRect.getSimpleRadii();
-    rRect->radii.set(radii.fX, radii.fY);
+    *rRect = analysis.rRect;
   }
   return true;
 }
@@ -404,6 +407,9 @@ PathRef* Path::writableRef() {
   } else {
     pathRef->uniqueKey.reset();
     pathRef->resetBounds();
+    pathRef->resetAnalysis();
+    pathRef->resetConvexity();
+    pathRef->resetMeasureCache();
   }
   return pathRef.get();
 }
@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "tgfx/core/PathMeasure.h"
+#include <cmath>
 #include "core/PathRef.h"
 
 namespace tgfx {
@@ -24,49 +25,126 @@ using namespace pk;
 
 class PkPathMeasure : public PathMeasure {
  public:
-  explicit PkPathMeasure(const SkPath& path) {
-    pathMeasure = new SkPathMeasure(path, false);
-  }
-
-  ~PkPathMeasure() override {
-    delete pathMeasure;
+  explicit PkPathMeasure(std::shared_ptr<PathMeasureCache> cache) : cache(std::move(cache)) {
   }
 
   float getLength() override {
-    return pathMeasure->getLength();
+    std::lock_guard<std::mutex> autoLock(cache->locker);
+    return cache->measure.getLength();
   }
 
   bool getSegment(float startD, float stopD, Path* result) override {
     if (result == nullptr) {
       return false;
     }
-    auto& path = PathRef::WriteAccess(*result);
-    return pathMeasure->getSegment(startD, stopD, &path, true);
+    std::lock_guard<std::mutex> autoLock(cache->locker);
+    return segmentTo(startD, stopD, result);
+  }
+
+  size_t getSegment(const float startD[], const float stopD[], size_t count,
+                    Path results[]) override {
+    if (startD == nullptr || stopD == nullptr || results == nullptr) {
+      return 0;
+    }
+    size_t segmentCount = 0;
+    std::lock_guard<std::mutex> autoLock(cache->locker);
+    for (size_t i = 0; i < count; i++) {
+      if (segmentTo(startD[i], stopD[i], &results[i])) {
+        segmentCount++;
+      }
+    }
+    return segmentCount;
   }
 
   bool getPosTan(float distance, Point* position, Point* tangent) override {
     if (position == nullptr || tangent == nullptr) {
       return false;
     }
+    return getPosTan(&distance, 1, position, tangent);
+  }
 
-    SkPoint point{};
-    SkVector tan{};
-
-    auto ret = pathMeasure->getPosTan(distance, &point, &tan);
-    position->set(point.x(), point.y());
-    tangent->set(tan.x(), tan.y());
-    return ret;
+  bool getPosTan(const float distances[], size_t count, Point positions[],
+                 Point tangents[]) override {
+    if (distances == nullptr || (positions == nullptr && tangents == nullptr)) {
+      return false;
+    }
+    std::lock_guard<std::mutex> autoLock(cache->locker);
+    auto& measure = cache->measure;
+    // Validates all distances before writing any output, so the outputs stay unchanged on failure.
+    // Past these checks, measure.getPosTan() can not fail for any of the distances.
+    if (measure.getLength() <= 0) {
+      return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+      if (std::isnan(distances[i])) {
+        return false;
+      }
+    }
+    SkPoint point = {};
+    SkVector tan = {};
+    for (size_t i = 0; i < count; i++) {
+      measure.getPosTan(distances[i], &point, &tan);
+      if (positions != nullptr) {
+        positions[i].set(point.x(), point.y());
+      }
+      if (tangents != nullptr) {
+        tangents[i].set(tan.x(), tan.y());
+      }
+    }
+    return true;
   }
 
   bool isClosed() override {
-    return pathMeasure->isClosed();
+    std::lock_guard<std::mutex> autoLock(cache->locker);
+    return cache->measure.isClosed();
   }
 
  private:
-  SkPathMeasure* pathMeasure = nullptr;
+  std::shared_ptr<PathMeasureCache> cache = nullptr;
+
+  bool segmentTo(float startD, float stopD, Path* result) {
+    auto& path = PathRef::WriteAccess(*result);
+    return cache->measure.getSegment(startD, stopD, &path, true);
+  }
 };
 
 std::unique_ptr<PathMeasure> PathMeasure::MakeFrom(const Path& path) {
-  return std::make_unique<PkPathMeasure>(PathRef::ReadAccess(path));
+  return std::make_unique<PkPathMeasure>(PathRef::GetMeasureCache(path));
+}
+
+bool PathMeasure::getPosTan(const float distances[], size_t count, Point positions[],
+                            Point tangents[]) {
+  if (distances == nullptr || (positions == nullptr && tangents == nullptr)) {
+    return false;
+  }
+  // Computes into temporary buffers first, so the outputs stay unchanged on failure.
+  std::vector<Point> positionList(count);
+  std::vector<Point> tangentList(count);
+  for (size_t i = 0; i < count; i++) {
+    if (!getPosTan(distances[i], &positionList[i], &tangentList[i])) {
+      return false;
+    }
+  }
+  if (positions != nullptr) {
+    std::copy(positionList.begin(), positionList.end(), positions);
+  }
+  if (tangents != nullptr) {
+    std::copy(tangentList.begin(), tangentList.end(), tangents);
+  }
+  return true;
+}
+
+size_t PathMeasure::getSegment(const float startD[], const float stopD[], size_t count,
+                               Path results[]) {
+  if (startD == nullptr || stopD == nullptr || results == nullptr) {
+    return 0;
+  }
+  size_t segmentCount = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (getSegment(startD[i], stopD[i], &results[i])) {
+      segmentCount++;
+    }
+  }
+  return segmentCount;
 }
-}  // namespace tgfx
\ No newline at end of file
+}  // namespace tgfx
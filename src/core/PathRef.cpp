@@ -34,22 +34,45 @@ UniqueKey PathRef::GetUniqueKey(const Path& path) {
   return path.pathRef->uniqueKey.get();
 }
 
+std::shared_ptr<PathMeasureCache> PathRef::GetMeasureCache(const Path& path) {
+  return path.pathRef->getMeasureCache();
+}
+
+const PathAnalysis& PathRef::GetAnalysis(const Path& path) {
+  return path.pathRef->getAnalysis();
+}
+
+bool PathRef::IsConvex(const Path& path) {
+  return path.pathRef->isConvex();
+}
+
 PathRef::~PathRef() {
   resetBounds();
+  resetAnalysis();
 }
 
 Rect PathRef::getBounds() {
   auto cacheBounds = bounds.load(std::memory_order_acquire);
   if (cacheBounds == nullptr) {
     // Internally, SkPath lazily computes bounds. Use this function instead of path.getBounds()
-    // for thread safety.
+    // for thread safety. The points are visited in place to avoid copying them to the heap.
+    auto newBounds = new Rect(Rect::MakeEmpty());
     auto count = path.countPoints();
-    auto points = new SkPoint[static_cast<size_t>(count)];
-    path.getPoints(points, count);
-    auto rect = SkRect::MakeEmpty();
-    rect.setBounds(points, count);
-    delete[] points;
-    auto newBounds = new Rect{rect.fLeft, rect.fTop, rect.fRight, rect.fBottom};
+    if (count > 0) {
+      auto point = path.getPoint(0);
+      float left = point.fX, top = point.fY, right = point.fX, bottom = point.fY;
+      for (int i = 1; i < count; i++) {
+        point = path.getPoint(i);
+        left = std::min(left, point.fX);
+        top = std::min(top, point.fY);
+        right = std::max(right, point.fX);
+        bottom = std::max(bottom, point.fY);
+      }
+      // Matches SkRect::setBounds(), which returns an empty rect if any point is not finite.
+      if ((left * 0 + top * 0 + right * 0 + bottom * 0) == 0) {
+        newBounds->setLTRB(left, top, right, bottom);
+      }
+    }
     if (bounds.compare_exchange_strong(cacheBounds, newBounds, std::memory_order_acq_rel)) {
       cacheBounds = newBounds;
     } else {
@@ -59,6 +82,77 @@ Rect PathRef::getBounds() {
   return *cacheBounds;
 }
 
+std::shared_ptr<PathMeasureCache> PathRef::getMeasureCache() {
+  std::lock_guard<std::mutex> autoLock(measureLocker);
+  if (measureCache == nullptr) {
+    measureCache = std::make_shared<PathMeasureCache>(path);
+  }
+  return measureCache;
+}
+
+void PathRef::resetMeasureCache() {
+  std::lock_guard<std::mutex> autoLock(measureLocker);
+  measureCache = nullptr;
+}
+
+const PathAnalysis& PathRef::getAnalysis() {
+  auto cacheAnalysis = analysis.load(std::memory_order_acquire);
+  if (cacheAnalysis == nullptr) {
+    auto newAnalysis = new PathAnalysis();
+    SkPoint line[2] = {};
+    SkRect rect = {};
+    SkRRect rRect = {};
+    if (path.isLine(line)) {
+      newAnalysis->shape = PathShape::Line;
+      newAnalysis->line[0].set(line[0].fX, line[0].fY);
+      newAnalysis->line[1].set(line[1].fX, line[1].fY);
+    } else if (path.isRect(&rect)) {
+      newAnalysis->shape = PathShape::Rect;
+      newAnalysis->rRect.rect.setLTRB(rect.fLeft, rect.fTop, rect.fRight, rect.fBottom);
+    } else if (path.isOval(&rect)) {
+      newAnalysis->shape = PathShape::Oval;
+      newAnalysis->rRect.rect.setLTRB(rect.fLeft, rect.fTop, rect.fRight, rect.fBottom);
+    } else if (path.isRRect(&rRect) && rRect.isSimple()) {
+      newAnalysis->shape = PathShape::RRect;
+      const auto& bounds = rRect.rect();
+      newAnalysis->rRect.rect.setLTRB(bounds.fLeft, bounds.fTop, bounds.fRight, bounds.fBottom);
+      auto radii = rRect.getSimpleRadii();
+      newAnalysis->rRect.radii.set(radii.fX, radii.fY);
+    }
+    if (analysis.compare_exchange_strong(cacheAnalysis, newAnalysis, std::memory_order_acq_rel)) {
+      cacheAnalysis = newAnalysis;
+    } else {
+      delete newAnalysis;
+    }
+  }
+  return *cacheAnalysis;
+}
+
+bool PathRef::isConvex() {
+  auto value = convexity.load(std::memory_order_acquire);
+  if (value == ConvexityUnknown) {
+    std::lock_guard<std::mutex> autoLock(convexityLocker);
+    value = convexity.load(std::memory_order_acquire);
+    if (value == ConvexityUnknown) {
+      // SkPath caches the convexity in itself when computing it, so compute it on a copy that
+      // shares the points, to keep this PathRef safe to read from multiple threads.
+      auto tempPath = path;
+      value = tempPath.isConvex() ? 1 : 0;
+      convexity.store(value, std::memory_order_release);
+    }
+  }
+  return value == 1;
+}
+
+void PathRef::resetConvexity() {
+  convexity.store(ConvexityUnknown, std::memory_order_release);
+}
+
+void PathRef::resetAnalysis() {
+  auto oldAnalysis = analysis.exchange(nullptr, std::memory_order_acq_rel);
+  delete oldAnalysis;
+}
+
 void PathRef::resetBounds() {
   auto oldBounds = bounds.exchange(nullptr, std::memory_order_acq_rel);
   delete oldBounds;
@@ -18,21 +18,78 @@
 
 #pragma once
 
+#include <mutex>
 #include "gpu/ResourceKey.h"
 #include "pathkit.h"
+#include "tgfx/core/RRect.h"
 
 namespace tgfx {
 class Path;
-struct Rect;
+
+/**
+ * Defines the simple shapes that a Path can be recognized as.
+ */
+enum class PathShape {
+  None,
+  Line,
+  Rect,
+  Oval,
+  RRect
+};
+
+/**
+ * The result of analyzing the shape of a path. It is computed the first time it is needed and
+ * reused until the path is modified.
+ */
+struct PathAnalysis {
+  PathShape shape = PathShape::None;
+  /**
+   * The end points of the line if shape is PathShape::Line.
+   */
+  Point line[2] = {};
+  /**
+   * The rect if shape is PathShape::Rect, the bounds of the oval if shape is PathShape::Oval, or
+   * the rounded rect if shape is PathShape::RRect.
+   */
+  RRect rRect = {};
+};
+
+/**
+ * The measured contour tables of a path, shared by all PathMeasures created from the same PathRef.
+ */
+struct PathMeasureCache {
+  explicit PathMeasureCache(const pk::SkPath& path) : measure(path, false) {
+  }
+
+  std::mutex locker = {};
+  pk::SkPathMeasure measure;
+};
 
 class PathRef {
  public:
+  static constexpr int ConvexityUnknown = -1;
+
   static const pk::SkPath& ReadAccess(const Path& path);
 
   static pk::SkPath& WriteAccess(Path& path);
 
   static UniqueKey GetUniqueKey(const Path& path);
 
+  /**
+   * Returns the cached measurement of the path, creating it if necessary.
+   */
+  static std::shared_ptr<PathMeasureCache> GetMeasureCache(const Path& path);
+
+  /**
+   * Returns the cached shape analysis of the path, computing it if necessary.
+   */
+  static const PathAnalysis& GetAnalysis(const Path& path);
+
+  /**
+   * Returns true if the path is convex, computing it if necessary.
+   */
+  static bool IsConvex(const Path& path);
+
   PathRef() = default;
 
   explicit PathRef(const pk::SkPath& path) : path(path) {
@@ -42,12 +99,25 @@ class PathRef {
 
   Rect getBounds();
 
+  const PathAnalysis& getAnalysis();
+
+  bool isConvex();
+
  private:
   LazyUniqueKey uniqueKey = {};
   std::atomic<Rect*> bounds = {nullptr};
+  std::atomic<PathAnalysis*> analysis = {nullptr};
+  std::atomic<int> convexity = {ConvexityUnknown};
+  std::mutex convexityLocker = {};
   pk::SkPath path = {};
+  std::mutex measureLocker = {};
+  std::shared_ptr<PathMeasureCache> measureCache = nullptr;
 
   void resetBounds();
+  void resetAnalysis();
+  void resetConvexity();
+  std::shared_ptr<PathMeasureCache> getMeasureCache();
+  void resetMeasureCache();
 
   friend bool operator==(const Path& a, const Path& b);
   friend bool operator!=(const Path& a, const Path& b);
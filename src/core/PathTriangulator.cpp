@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "PathTriangulator.h"
+#include <cmath>
 #include "PathRef.h"
 #include "pathkit.h"
 
@@ -29,6 +30,212 @@ namespace tgfx {
  */
 static constexpr float DefaultTolerance = 0.25f;
 
+/**
+ * The maximum number of line segments a single curve is flattened into.
+ */
+static constexpr int MaxCurveSegments = 100;
+
+static int ComputeCurveSegments(const Point& p0, const Point& p1, const Point& p2,
+                                float degreeFactor) {
+  // Wang's formula, the number of segments that keeps the deviation under DefaultTolerance.
+  auto dx = p0.x - 2 * p1.x + p2.x;
+  auto dy = p0.y - 2 * p1.y + p2.y;
+  auto length = sqrtf(dx * dx + dy * dy);
+  auto segments = ceilf(sqrtf(degreeFactor * length / DefaultTolerance));
+  return std::max(1, std::min(static_cast<int>(segments), MaxCurveSegments));
+}
+
+static void AddPolygonPoint(std::vector<Point>* polygon, const Point& point) {
+  if (!polygon->empty() && polygon->back() == point) {
+    return;
+  }
+  polygon->push_back(point);
+}
+
+struct FlattenInfo {
+  std::vector<Point> polygon = {};
+  bool finished = false;
+  bool hasMoreContours = false;
+};
+
+/**
+ * Flattens the first contour of a convex path into a polygon. Returns false if the path has more
+ * than one contour or the polygon is degenerate.
+ */
+static bool FlattenConvexPath(const Path& path, std::vector<Point>* polygon) {
+  FlattenInfo flattenInfo = {};
+  auto iterator = [](PathVerb verb, const Point points[4], void* info) {
+    auto flatten = reinterpret_cast<FlattenInfo*>(info);
+    auto& polygon = flatten->polygon;
+    switch (verb) {
+      case PathVerb::Move:
+        if (polygon.size() > 1) {
+          // Only a contour with segments after this point makes the path unsupported, a trailing
+          // move is ignored.
+          flatten->finished = true;
+        } else {
+          polygon.clear();
+          AddPolygonPoint(&polygon, points[0]);
+        }
+        return;
+      case PathVerb::Close:
+        return;
+      default:
+        break;
+    }
+    if (flatten->finished) {
+      flatten->hasMoreContours = true;
+      return;
+    }
+    switch (verb) {
+      case PathVerb::Line:
+        AddPolygonPoint(&polygon, points[1]);
+        break;
+      case PathVerb::Quad: {
+        auto count = ComputeCurveSegments(points[0], points[1], points[2], 0.25f);
+        for (int i = 1; i <= count; i++) {
+          auto t = static_cast<float>(i) / static_cast<float>(count);
+          auto u = 1 - t;
+          auto x = u * u * points[0].x + 2 * u * t * points[1].x + t * t * points[2].x;
+          auto y = u * u * points[0].y + 2 * u * t * points[1].y + t * t * points[2].y;
+          AddPolygonPoint(&polygon, Point::Make(x, y));
+        }
+        break;
+      }
+      case PathVerb::Cubic: {
+        auto count = std::max(ComputeCurveSegments(points[0], points[1], points[2], 0.75f),
+                              ComputeCurveSegments(points[1], points[2], points[3], 0.75f));
+        for (int i = 1; i <= count; i++) {
+          auto t = static_cast<float>(i) / static_cast<float>(count);
+          auto u = 1 - t;
+          auto a = u * u * u, b = 3 * u * u * t, c = 3 * u * t * t, d = t * t * t;
+          auto x = a * points[0].x + b * points[1].x + c * points[2].x + d * points[3].x;
+          auto y = a * points[0].y + b * points[1].y + c * points[2].y + d * points[3].y;
+          AddPolygonPoint(&polygon, Point::Make(x, y));
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  };
+  path.decompose(iterator, &flattenInfo);
+  if (flattenInfo.hasMoreContours) {
+    return false;
+  }
+  auto& points = flattenInfo.polygon;
+  if (points.size() > 1 && points.front() == points.back()) {
+    points.pop_back();
+  }
+  if (points.size() < 3) {
+    return false;
+  }
+  *polygon = std::move(points);
+  return true;
+}
+
+/**
+ * Returns twice the signed area of the polygon, positive if the polygon is clockwise in a y-down
+ * coordinate system.
+ */
+static float ComputeSignedArea(const std::vector<Point>& polygon) {
+  float area = 0;
+  auto count = polygon.size();
+  for (size_t i = 0; i < count; i++) {
+    auto& p0 = polygon[i];
+    auto& p1 = polygon[(i + 1) % count];
+    area += p0.x * p1.y - p1.x * p0.y;
+  }
+  return area;
+}
+
+static void WriteVertex(std::vector<float>* vertices, const Point& point) {
+  vertices->push_back(point.x);
+  vertices->push_back(point.y);
+}
+
+static void WriteVertex(std::vector<float>* vertices, const Point& point, float coverage) {
+  vertices->push_back(point.x);
+  vertices->push_back(point.y);
+  vertices->push_back(coverage);
+}
+
+size_t PathTriangulator::ToConvexTriangles(const Path& path, std::vector<float>* vertices) {
+  std::vector<Point> polygon = {};
+  if (!FlattenConvexPath(path, &polygon) || ComputeSignedArea(polygon) == 0) {
+    return 0;
+  }
+  auto count = polygon.size();
+  vertices->reserve(vertices->size() + (count - 2) * 6);
+  for (size_t i = 1; i + 1 < count; i++) {
+    WriteVertex(vertices, polygon[0]);
+    WriteVertex(vertices, polygon[i]);
+    WriteVertex(vertices, polygon[i + 1]);
+  }
+  return count - 2;
+}
+
+size_t PathTriangulator::ToConvexAATriangles(const Path& path, std::vector<float>* vertices) {
+  std::vector<Point> polygon = {};
+  if (!FlattenConvexPath(path, &polygon)) {
+    return 0;
+  }
+  auto area = ComputeSignedArea(polygon);
+  if (area == 0) {
+    return 0;
+  }
+  auto count = polygon.size();
+  // Outward unit normals of each edge, the edge i goes from polygon[i] to polygon[i + 1].
+  auto direction = area > 0 ? -1.0f : 1.0f;
+  std::vector<Point> normals(count);
+  for (size_t i = 0; i < count; i++) {
+    auto edge = polygon[(i + 1) % count] - polygon[i];
+    auto length = edge.length();
+    if (length == 0) {
+      return 0;
+    }
+    normals[i] = Point::Make(-edge.y * direction / length, edge.x * direction / length);
+  }
+  // Each vertex is moved half a pixel inward and outward along the miter direction of its two
+  // edges, the miter length is limited to avoid spikes at sharp corners.
+  std::vector<Point> innerPoints(count);
+  std::vector<Point> outerPoints(count);
+  for (size_t i = 0; i < count; i++) {
+    auto& prevNormal = normals[(i + count - 1) % count];
+    auto& nextNormal = normals[i];
+    auto miter = prevNormal + nextNormal;
+    auto miterLength = miter.length();
+    if (miterLength == 0) {
+      return 0;
+    }
+    miter.set(miter.x / miterLength, miter.y / miterLength);
+    auto cosine = std::max(miter.x * nextNormal.x + miter.y * nextNormal.y, 0.25f);
+    auto offset = 0.5f / cosine;
+    innerPoints[i] = polygon[i] - Point::Make(miter.x * offset, miter.y * offset);
+    outerPoints[i] = polygon[i] + Point::Make(miter.x * offset, miter.y * offset);
+  }
+  // The inner polygon collapses if the shape is thinner than the alpha ramps.
+  if (ComputeSignedArea(innerPoints) * area <= 0) {
+    return 0;
+  }
+  vertices->reserve(vertices->size() + (count - 2 + count * 2) * 9);
+  for (size_t i = 1; i + 1 < count; i++) {
+    WriteVertex(vertices, innerPoints[0], 1.0f);
+    WriteVertex(vertices, innerPoints[i], 1.0f);
+    WriteVertex(vertices, innerPoints[i + 1], 1.0f);
+  }
+  for (size_t i = 0; i < count; i++) {
+    auto next = (i + 1) % count;
+    WriteVertex(vertices, outerPoints[i], 0.0f);
+    WriteVertex(vertices, outerPoints[next], 0.0f);
+    WriteVertex(vertices, innerPoints[i], 1.0f);
+    WriteVertex(vertices, innerPoints[i], 1.0f);
+    WriteVertex(vertices, outerPoints[next], 0.0f);
+    WriteVertex(vertices, innerPoints[next], 1.0f);
+  }
+  return count - 2 + count * 2;
+}
+
 size_t PathTriangulator::GetTriangleCount(size_t bufferSize) {
   return bufferSize / (sizeof(float) * 2);
 }
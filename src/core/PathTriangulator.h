@@ -50,5 +50,20 @@ class PathTriangulator {
    */
   static size_t ToAATriangles(const Path& path, const Rect& clipBounds,
                               std::vector<float>* vertices);
+
+  /**
+   * Tessellates a convex path into a triangle fan, in the same vertex layout as ToTriangles(). The
+   * path must be convex and in device space. Returns the number of triangles written to the
+   * vertices, or 0 if the path is not a single convex polygon after flattening.
+   */
+  static size_t ToConvexTriangles(const Path& path, std::vector<float>* vertices);
+
+  /**
+   * Tessellates a convex path into a triangle fan with a one-pixel wide alpha ramp along each edge
+   * for antialiasing, in the same vertex layout as ToAATriangles(). The path must be convex and in
+   * device space. Returns the number of triangles written to the vertices, or 0 if the path is not
+   * a single convex polygon after flattening or is too thin for the alpha ramps.
+   */
+  static size_t ToConvexAATriangles(const Path& path, std::vector<float>* vertices);
 };
 }  // namespace tgfx
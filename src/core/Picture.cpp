@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "tgfx/core/Picture.h"
+#include "core/HitTestContext.h"
 #include "core/MeasureContext.h"
 #include "core/Records.h"
 #include "core/TransformContext.h"
@@ -41,6 +42,17 @@ Rect Picture::getBounds(const Matrix& matrix) const {
   return context.getBounds();
 }
 
+bool Picture::hitTest(float x, float y) const {
+  HitTestContext context(x, y);
+  for (auto record = records.rbegin(); record != records.rend(); ++record) {
+    (*record)->playback(&context);
+    if (context.hasHit()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void Picture::playback(Canvas* canvas) const {
   if (canvas == nullptr) {
     return;
@@ -94,7 +94,7 @@ std::shared_ptr<PixelBuffer> PixelBuffer::Make(int width, int height, bool alpha
   if (width <= 0 || height <= 0) {
     return nullptr;
   }
-  if (tryHardware) {
+  if (tryHardware && HardwareBufferAvailable()) {
     auto hardwareBuffer = HardwareBufferAllocate(width, height, alphaOnly);
     auto pixelBuffer = PixelBuffer::MakeFrom(hardwareBuffer);
     HardwareBufferRelease(hardwareBuffer);
@@ -139,7 +139,11 @@ void PixelBuffer::unlockPixels() {
 std::shared_ptr<Texture> PixelBuffer::onMakeTexture(Context* context, bool mipmapped) const {
   std::lock_guard<std::mutex> autoLock(locker);
   if (!mipmapped && isHardwareBacked()) {
-    return onBindToHardwareTexture(context);
+    auto texture = onBindToHardwareTexture(context);
+    if (texture != nullptr) {
+      return texture;
+    }
+    // The GPU can not import this buffer directly, so its pixels are uploaded instead.
   }
   auto pixels = onLockPixels();
   if (pixels == nullptr) {
@@ -49,6 +49,16 @@ void RecordingContext::drawRRect(const RRect& rRect, const MCState& state, const
   records.push_back(new DrawRRect(rRect, state, style));
 }
 
+void RecordingContext::drawRects(const std::vector<Rect>& rects, const MCState& state,
+                                 const FillStyle& style) {
+  records.push_back(new DrawRects(rects, state, style));
+}
+
+void RecordingContext::drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                                  const FillStyle& style) {
+  records.push_back(new DrawRRects(rRects, state, style));
+}
+
 void RecordingContext::drawPath(const Path& path, const MCState& state, const FillStyle& style,
                                 const Stroke* stroke) {
   if (stroke && stroke->width > 0) {
@@ -72,6 +82,16 @@ void RecordingContext::drawImageRect(std::shared_ptr<Image> image, const Samplin
   }
 }
 
+void RecordingContext::drawImagePatches(std::shared_ptr<Image> image,
+                                        const SamplingOptions& sampling,
+                                        const std::vector<ImagePatch>& patches,
+                                        const MCState& state, const FillStyle& style) {
+  if (image == nullptr) {
+    return;
+  }
+  records.push_back(new DrawImagePatches(std::move(image), sampling, patches, state, style));
+}
+
 void RecordingContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                                     const Stroke* stroke) {
   if (stroke && stroke->width > 0) {
@@ -81,6 +101,14 @@ void RecordingContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state, con
   }
 }
 
+void RecordingContext::drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                                    const FillStyle& style) {
+  if (vertices == nullptr) {
+    return;
+  }
+  records.push_back(new DrawVertices(std::move(vertices), state, style));
+}
+
 void RecordingContext::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
                                  const FillStyle& style, std::shared_ptr<ImageFilter> filter) {
   if (picture == nullptr) {
@@ -33,15 +33,28 @@ class RecordingContext : public DrawContext {
 
   void drawRRect(const RRect& rRect, const MCState& state, const FillStyle& style) override;
 
+  void drawRects(const std::vector<Rect>& rects, const MCState& state,
+                 const FillStyle& style) override;
+
+  void drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                  const FillStyle& style) override;
+
   void drawPath(const Path& path, const MCState& state, const FillStyle& style,
                 const Stroke* stroke) override;
 
   void drawImageRect(std::shared_ptr<Image> image, const SamplingOptions& sampling,
                      const Rect& rect, const MCState& state, const FillStyle& style) override;
 
+  void drawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                        const std::vector<ImagePatch>& patches, const MCState& state,
+                        const FillStyle& style) override;
+
   void drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                     const Stroke* stroke) override;
 
+  void drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                    const FillStyle& style) override;
+
   void drawLayer(std::shared_ptr<Picture> picture, const MCState& state, const FillStyle& style,
                  std::shared_ptr<ImageFilter> filter) override;
 
@@ -24,12 +24,16 @@ namespace tgfx {
 enum class RecordType {
   DrawRect,
   DrawRRect,
+  DrawRects,
+  DrawRRects,
   DrawPath,
   StrokePath,
   DrawImage,
   DrawImageRect,
+  DrawImagePatches,
   DrawGlyphRun,
   StrokeGlyphRun,
+  DrawVertices,
   DrawPicture,
   DrawLayer
 };
@@ -81,6 +85,44 @@ class DrawRRect : public Record {
   FillStyle style;
 };
 
+class DrawRects : public Record {
+ public:
+  DrawRects(std::vector<Rect> rects, MCState state, FillStyle style)
+      : rects(std::move(rects)), state(std::move(state)), style(std::move(style)) {
+  }
+
+  RecordType type() const override {
+    return RecordType::DrawRects;
+  }
+
+  void playback(DrawContext* context) const override {
+    context->drawRects(rects, state, style);
+  }
+
+  std::vector<Rect> rects;
+  MCState state;
+  FillStyle style;
+};
+
+class DrawRRects : public Record {
+ public:
+  DrawRRects(std::vector<RRect> rRects, MCState state, FillStyle style)
+      : rRects(std::move(rRects)), state(std::move(state)), style(std::move(style)) {
+  }
+
+  RecordType type() const override {
+    return RecordType::DrawRRects;
+  }
+
+  void playback(DrawContext* context) const override {
+    context->drawRRects(rRects, state, style);
+  }
+
+  std::vector<RRect> rRects;
+  MCState state;
+  FillStyle style;
+};
+
 class DrawPath : public Record {
  public:
   DrawPath(Path path, MCState state, FillStyle style)
@@ -159,6 +201,25 @@ class DrawImageRect : public DrawImage {
   Rect rect;
 };
 
+class DrawImagePatches : public DrawImage {
+ public:
+  DrawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                   std::vector<ImagePatch> patches, MCState state, FillStyle style)
+      : DrawImage(std::move(image), sampling, std::move(state), std::move(style)),
+        patches(std::move(patches)) {
+  }
+
+  RecordType type() const override {
+    return RecordType::DrawImagePatches;
+  }
+
+  void playback(DrawContext* context) const override {
+    context->drawImagePatches(image, sampling, patches, state, style);
+  }
+
+  std::vector<ImagePatch> patches;
+};
+
 class DrawGlyphRun : public Record {
  public:
   DrawGlyphRun(GlyphRun glyphRun, MCState state, FillStyle style)
@@ -195,6 +256,25 @@ class StrokeGlyphRun : public DrawGlyphRun {
   Stroke stroke;
 };
 
+class DrawVertices : public Record {
+ public:
+  DrawVertices(std::shared_ptr<Vertices> vertices, MCState state, FillStyle style)
+      : vertices(std::move(vertices)), state(std::move(state)), style(std::move(style)) {
+  }
+
+  RecordType type() const override {
+    return RecordType::DrawVertices;
+  }
+
+  void playback(DrawContext* context) const override {
+    context->drawVertices(vertices, state, style);
+  }
+
+  std::shared_ptr<Vertices> vertices;
+  MCState state;
+  FillStyle style;
+};
+
 class DrawPicture : public Record {
  public:
   DrawPicture(std::shared_ptr<Picture> picture, MCState state)
@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "tgfx/core/RuntimeEffect.h"
+#include <unordered_set>
+#include "filters/RuntimeColorFilter.h"
+#include "shaders/RuntimeShader.h"
+#include "utils/UniqueID.h"
+
+namespace tgfx {
+static size_t FloatCount(RuntimeEffect::UniformType type) {
+  switch (type) {
+    case RuntimeEffect::UniformType::Float:
+      return 1;
+    case RuntimeEffect::UniformType::Float2:
+      return 2;
+    case RuntimeEffect::UniformType::Float3:
+      return 3;
+    case RuntimeEffect::UniformType::Float4:
+    case RuntimeEffect::UniformType::Float2x2:
+      return 4;
+    case RuntimeEffect::UniformType::Float3x3:
+      return 9;
+    case RuntimeEffect::UniformType::Float4x4:
+      return 16;
+  }
+  return 0;
+}
+
+static bool IsValidUniformName(const std::string& name) {
+  if (name.empty() || name == "coord" || name == "color" || name.compare(0, 3, "gl_") == 0 ||
+      name.compare(0, 5, "child") == 0) {
+    return false;
+  }
+  if (!isalpha(name[0]) && name[0] != '_') {
+    return false;
+  }
+  for (auto c : name) {
+    if (!isalnum(c) && c != '_') {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::shared_ptr<RuntimeEffect> RuntimeEffect::Make(std::string code, std::vector<Uniform> uniforms,
+                                                   size_t childCount) {
+  if (code.empty()) {
+    return nullptr;
+  }
+  std::unordered_set<std::string> names = {};
+  for (auto& uniform : uniforms) {
+    if (!IsValidUniformName(uniform.name) || !names.insert(uniform.name).second) {
+      return nullptr;
+    }
+  }
+  auto effect = std::shared_ptr<RuntimeEffect>(
+      new RuntimeEffect(std::move(code), std::move(uniforms), childCount));
+  effect->weakThis = effect;
+  return effect;
+}
+
+RuntimeEffect::RuntimeEffect(std::string code, std::vector<Uniform> uniforms, size_t childCount)
+    : uniqueID(UniqueID::Next()), _code(std::move(code)), _uniforms(std::move(uniforms)),
+      _childCount(childCount) {
+}
+
+size_t RuntimeEffect::uniformSize() const {
+  size_t size = 0;
+  for (auto& uniform : _uniforms) {
+    size += FloatCount(uniform.type);
+  }
+  return size;
+}
+
+std::shared_ptr<Shader> RuntimeEffect::makeShader(
+    std::vector<float> uniformValues, std::vector<std::shared_ptr<Shader>> children) const {
+  if (uniformValues.size() != uniformSize() || children.size() != _childCount) {
+    return nullptr;
+  }
+  for (auto& child : children) {
+    if (child == nullptr) {
+      return nullptr;
+    }
+  }
+  auto shader = std::make_shared<RuntimeShader>(weakThis.lock(), std::move(uniformValues),
+                                                std::move(children));
+  shader->weakThis = shader;
+  return shader;
+}
+
+std::shared_ptr<ColorFilter> RuntimeEffect::makeColorFilter(
+    std::vector<float> uniformValues) const {
+  if (uniformValues.size() != uniformSize() || _childCount > 0) {
+    return nullptr;
+  }
+  return std::make_shared<RuntimeColorFilter>(weakThis.lock(), std::move(uniformValues));
+}
+}  // namespace tgfx
@@ -55,6 +55,16 @@ class TransformContext : public DrawContext {
     drawContext->drawRRect(rRect, transform(state), style);
   }
 
+  void drawRects(const std::vector<Rect>& rects, const MCState& state,
+                 const FillStyle& style) override {
+    drawContext->drawRects(rects, transform(state), style);
+  }
+
+  void drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                  const FillStyle& style) override {
+    drawContext->drawRRects(rRects, transform(state), style);
+  }
+
   void drawPath(const Path& path, const MCState& state, const FillStyle& style,
                 const Stroke* stroke) override {
     drawContext->drawPath(path, transform(state), style, stroke);
@@ -65,11 +75,22 @@ class TransformContext : public DrawContext {
     drawContext->drawImageRect(std::move(image), sampling, rect, transform(state), style);
   }
 
+  void drawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                        const std::vector<ImagePatch>& patches, const MCState& state,
+                        const FillStyle& style) override {
+    drawContext->drawImagePatches(std::move(image), sampling, patches, transform(state), style);
+  }
+
   void drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                     const Stroke* stroke) override {
     drawContext->drawGlyphRun(std::move(glyphRun), transform(state), style, stroke);
   }
 
+  void drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                    const FillStyle& style) override {
+    drawContext->drawVertices(std::move(vertices), transform(state), style);
+  }
+
   void drawPicture(std::shared_ptr<Picture> picture, const MCState& state) override {
     drawContext->drawPicture(std::move(picture), transform(state));
   }
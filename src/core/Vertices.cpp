@@ -0,0 +1,52 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "tgfx/core/Vertices.h"
+
+namespace tgfx {
+std::shared_ptr<Vertices> Vertices::MakeCopy(const Point positions[], const Point texCoords[],
+                                             const Color colors[], size_t vertexCount,
+                                             const uint16_t indices[], size_t indexCount) {
+  if (positions == nullptr || vertexCount < 3) {
+    return nullptr;
+  }
+  if (indices != nullptr) {
+    if (indexCount < 3) {
+      return nullptr;
+    }
+    for (size_t i = 0; i < indexCount; ++i) {
+      if (indices[i] >= vertexCount) {
+        return nullptr;
+      }
+    }
+  }
+  auto vertices = std::shared_ptr<Vertices>(new Vertices());
+  vertices->_positions = {positions, positions + vertexCount};
+  if (texCoords != nullptr) {
+    vertices->_texCoords = {texCoords, texCoords + vertexCount};
+  }
+  if (colors != nullptr) {
+    vertices->_colors = {colors, colors + vertexCount};
+  }
+  if (indices != nullptr) {
+    vertices->_indices = {indices, indices + indexCount};
+  }
+  vertices->_bounds.setBounds(positions, static_cast<int>(vertexCount));
+  return vertices;
+}
+}  // namespace tgfx
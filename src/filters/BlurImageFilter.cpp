@@ -99,9 +99,11 @@ void BlurImageFilter::draw(std::shared_ptr<RenderTargetProxy> renderTarget,
   opContext.fillWithFP(std::move(blurProcessor), localMatrix, true);
 }
 
-Rect BlurImageFilter::onFilterBounds(const Rect& srcRect) const {
+Rect BlurImageFilter::onFilterBounds(const Rect& rect, MapDirection) const {
+  // The blur kernel is symmetric, so an output pixel reads as far into the input as an input pixel
+  // spreads into the output.
   auto mul = static_cast<float>(std::pow(2, iteration)) / downScaling;
-  return srcRect.makeOutset(blurOffset.x * mul, blurOffset.y * mul);
+  return rect.makeOutset(blurOffset.x * mul, blurOffset.y * mul);
 }
 
 std::unique_ptr<FragmentProcessor> BlurImageFilter::onFilterImage(std::shared_ptr<Image> source,
@@ -117,15 +119,22 @@ std::unique_ptr<FragmentProcessor> BlurImageFilter::onFilterImage(std::shared_pt
   if (!applyCropRect(inputBounds, &dstBounds, &clipBounds)) {
     return nullptr;
   }
-  inputBounds.intersect(clipBounds);
+  // Only the source pixels that the kernel pulls into the visible output need to be sampled.
+  inputBounds.intersect(filterBounds(dstBounds, MapDirection::Reverse));
   FPArgs newArgs(args.context, args.renderFlags, inputBounds, Matrix::I());
   auto processor = FragmentProcessor::Make(source, newArgs, tileMode, tileMode, {});
   auto imageBounds = dstBounds;
   std::vector<std::shared_ptr<RenderTargetProxy>> renderTargets = {};
   auto mipmapped = source->hasMipmaps() && sampling.mipmapMode != MipmapMode::None;
-  auto lastRenderTarget = RenderTargetProxy::Make(
+  // Blurring never adds color, so the intermediate targets of an alpha-only source only need the
+  // alpha channel, which cuts their memory bandwidth to a quarter.
+  std::vector<PixelFormat> formats = {PixelFormat::RGBA_8888};
+  if (source->isAlphaOnly()) {
+    formats.insert(formats.begin(), PixelFormat::ALPHA_8);
+  }
+  auto lastRenderTarget = RenderTargetProxy::MakeFallback(
       args.context, static_cast<int>(imageBounds.width()), static_cast<int>(imageBounds.height()),
-      PixelFormat::RGBA_8888, 1, mipmapped);
+      formats, 1, mipmapped);
   if (lastRenderTarget == nullptr) {
     return nullptr;
   }
@@ -136,7 +145,8 @@ std::unique_ptr<FragmentProcessor> BlurImageFilter::onFilterImage(std::shared_pt
     }
     auto downWidth = std::max(static_cast<int>(roundf(imageBounds.width() * downScaling)), 1);
     auto downHeight = std::max(static_cast<int>(roundf(imageBounds.height() * downScaling)), 1);
-    auto renderTarget = RenderTargetProxy::Make(args.context, downWidth, downHeight);
+    auto renderTarget =
+        RenderTargetProxy::Make(args.context, downWidth, downHeight, lastRenderTarget->format());
     if (renderTarget == nullptr) {
       return nullptr;
     }
@@ -32,7 +32,7 @@ class BlurImageFilter : public ImageFilter {
   int iteration;
   TileMode tileMode;
 
-  Rect onFilterBounds(const Rect& srcRect) const override;
+  Rect onFilterBounds(const Rect& rect, MapDirection mapDirection) const override;
 
   std::unique_ptr<FragmentProcessor> onFilterImage(std::shared_ptr<Image> source,
                                                    const FPArgs& args,
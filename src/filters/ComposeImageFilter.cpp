@@ -63,10 +63,16 @@ ComposeImageFilter::ComposeImageFilter(std::vector<std::shared_ptr<ImageFilter>>
     : filters(std::move(filters)) {
 }
 
-Rect ComposeImageFilter::onFilterBounds(const Rect& srcRect) const {
-  auto bounds = srcRect;
-  for (auto& filter : filters) {
-    bounds = filter->filterBounds(bounds);
+Rect ComposeImageFilter::onFilterBounds(const Rect& rect, MapDirection mapDirection) const {
+  auto bounds = rect;
+  if (mapDirection == MapDirection::Forward) {
+    for (auto& filter : filters) {
+      bounds = filter->filterBounds(bounds);
+    }
+  } else {
+    for (auto i = filters.rbegin(); i != filters.rend(); ++i) {
+      bounds = (*i)->filterBounds(bounds, MapDirection::Reverse);
+    }
   }
   return bounds;
 }
@@ -80,14 +86,28 @@ std::unique_ptr<FragmentProcessor> ComposeImageFilter::onFilterImage(
     drawBounds = localMatrix->mapRect(drawBounds);
   }
   auto count = filters.size() - 1;
+  // Walks the chain backwards to find the area each intermediate result has to cover, so that the
+  // final output inside drawBounds is complete while nothing outside of it gets processed.
+  std::vector<Rect> requiredBounds(count);
+  auto requestedBounds = drawBounds;
+  for (size_t i = count; i > 0; --i) {
+    requestedBounds = filters[i]->filterBounds(requestedBounds, MapDirection::Reverse);
+    requiredBounds[i - 1] = requestedBounds;
+  }
   auto lastSource = source;
   Matrix lastLocalMatrix = localMatrix ? *localMatrix : Matrix::I();
   for (size_t i = 0; i < count; ++i) {
     auto& filter = filters[i];
-    if (!filter->applyCropRect(bounds, &bounds, &drawBounds)) {
+    if (!filter->applyCropRect(bounds, &bounds, &requiredBounds[i])) {
       return nullptr;
     }
-    auto processor = filter->onFilterImage(std::move(lastSource), args, {}, &lastLocalMatrix);
+    Matrix invertMatrix = Matrix::I();
+    if (!lastLocalMatrix.invert(&invertMatrix)) {
+      return nullptr;
+    }
+    FPArgs stageArgs(args.context, args.renderFlags, invertMatrix.mapRect(bounds),
+                     args.viewMatrix);
+    auto processor = filter->onFilterImage(std::move(lastSource), stageArgs, {}, &lastLocalMatrix);
     if (processor == nullptr) {
       return nullptr;
     }
@@ -97,10 +117,7 @@ std::unique_ptr<FragmentProcessor> ComposeImageFilter::onFilterImage(
                                                 static_cast<int>(bounds.height()),
                                                 PixelFormat::RGBA_8888, 1, mipmapped);
     OpContext opContext(renderTarget);
-    Matrix offsetMatrix = Matrix::I();
-    if (!lastLocalMatrix.invert(&offsetMatrix)) {
-      return nullptr;
-    }
+    auto offsetMatrix = invertMatrix;
     offsetMatrix.preTranslate(bounds.x(), bounds.y());
     opContext.fillWithFP(std::move(processor), offsetMatrix, true);
     lastSource = TextureImage::Wrap(renderTarget->getTextureProxy());
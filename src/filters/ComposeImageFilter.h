@@ -28,7 +28,7 @@ class ComposeImageFilter : public ImageFilter {
  private:
   std::vector<std::shared_ptr<ImageFilter>> filters = {};
 
-  Rect onFilterBounds(const Rect& srcRect) const override;
+  Rect onFilterBounds(const Rect& rect, MapDirection mapDirection) const override;
 
   std::unique_ptr<FragmentProcessor> onFilterImage(std::shared_ptr<Image> source,
                                                    const FPArgs& args,
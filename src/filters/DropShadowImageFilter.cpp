@@ -17,6 +17,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "DropShadowImageFilter.h"
+#include <mutex>
+#include <unordered_set>
 #include "gpu/OpContext.h"
 #include "gpu/processors/ConstColorProcessor.h"
 #include "gpu/processors/FragmentProcessor.h"
@@ -35,20 +37,64 @@ std::shared_ptr<ImageFilter> ImageFilter::DropShadowOnly(float dx, float dy, flo
   return std::make_shared<DropShadowImageFilter>(dx, dy, blurrinessX, blurrinessY, color, true);
 }
 
+// The public ImageFilter class has no type information, and RTTI is disabled on some platforms,
+// so the live drop shadow filters are tracked here instead.
+static std::mutex& DropShadowFiltersLocker() {
+  static auto& locker = *new std::mutex();
+  return locker;
+}
+
+static std::unordered_set<const ImageFilter*>& DropShadowFilters() {
+  static auto& filters = *new std::unordered_set<const ImageFilter*>();
+  return filters;
+}
+
+const DropShadowImageFilter* DropShadowImageFilter::Cast(const ImageFilter* filter) {
+  if (filter == nullptr) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> autoLock(DropShadowFiltersLocker());
+  if (DropShadowFilters().count(filter) == 0) {
+    return nullptr;
+  }
+  return static_cast<const DropShadowImageFilter*>(filter);
+}
+
 DropShadowImageFilter::DropShadowImageFilter(float dx, float dy, float blurrinessX,
                                              float blurrinessY, const Color& color, bool shadowOnly)
     : dx(dx), dy(dy), blurFilter(ImageFilter::Blur(blurrinessX, blurrinessY)), color(color),
       shadowOnly(shadowOnly) {
+  std::lock_guard<std::mutex> autoLock(DropShadowFiltersLocker());
+  DropShadowFilters().insert(this);
 }
 
-Rect DropShadowImageFilter::onFilterBounds(const Rect& srcRect) const {
-  auto bounds = srcRect;
-  bounds.offset(dx, dy);
-  if (blurFilter != nullptr) {
-    bounds = blurFilter->filterBounds(bounds);
+DropShadowImageFilter::~DropShadowImageFilter() {
+  std::lock_guard<std::mutex> autoLock(DropShadowFiltersLocker());
+  DropShadowFilters().erase(this);
+}
+
+Rect DropShadowImageFilter::blurExtent() const {
+  if (blurFilter == nullptr) {
+    return Rect::MakeEmpty();
+  }
+  return blurFilter->onFilterBounds(Rect::MakeEmpty(), MapDirection::Forward);
+}
+
+Rect DropShadowImageFilter::onFilterBounds(const Rect& rect, MapDirection mapDirection) const {
+  auto bounds = rect;
+  if (mapDirection == MapDirection::Forward) {
+    bounds.offset(dx, dy);
+    if (blurFilter != nullptr) {
+      bounds = blurFilter->filterBounds(bounds);
+    }
+  } else {
+    if (blurFilter != nullptr) {
+      bounds = blurFilter->filterBounds(bounds, MapDirection::Reverse);
+    }
+    bounds.offset(-dx, -dy);
   }
   if (!shadowOnly) {
-    bounds.join(srcRect);
+    bounds.join(rect);
   }
   return bounds;
 }
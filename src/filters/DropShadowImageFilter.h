@@ -23,9 +23,22 @@
 namespace tgfx {
 class DropShadowImageFilter : public ImageFilter {
  public:
+  /**
+   * Returns the given filter as a DropShadowImageFilter if it is one, otherwise returns nullptr.
+   */
+  static const DropShadowImageFilter* Cast(const ImageFilter* filter);
+
   DropShadowImageFilter(float dx, float dy, float blurrinessX, float blurrinessY,
                         const Color& color, bool shadowOnly);
 
+  ~DropShadowImageFilter() override;
+
+  /**
+   * Returns the extent the blur adds around a shape on each side, or an empty rect if there is no
+   * blur.
+   */
+  Rect blurExtent() const;
+
  private:
   float dx = 0;
   float dy = 0;
@@ -33,7 +46,9 @@ class DropShadowImageFilter : public ImageFilter {
   Color color = Color::Black();
   bool shadowOnly = false;
 
-  Rect onFilterBounds(const Rect& srcRect) const override;
+  friend class RenderContext;
+
+  Rect onFilterBounds(const Rect& rect, MapDirection mapDirection) const override;
 
   std::unique_ptr<FragmentProcessor> onFilterImage(std::shared_ptr<Image> source,
                                                    const FPArgs& args,
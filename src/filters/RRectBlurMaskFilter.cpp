@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "RRectBlurMaskFilter.h"
+#include <cmath>
+#include "gpu/processors/RRectBlurEffect.h"
+
+namespace tgfx {
+std::shared_ptr<MaskFilter> RRectBlurMaskFilter::Make(const RRect& rRect, float sigmaX,
+                                                      float sigmaY) {
+  if (rRect.rect.isEmpty() || sigmaX <= 0.0f || sigmaY <= 0.0f) {
+    return nullptr;
+  }
+  // Scaling the y-axis by sigmaX / sigmaY turns the blur into an isotropic one, which the effect
+  // requires. The corners then have to be circular in the scaled space.
+  auto scaleY = sigmaX / sigmaY;
+  auto radiusX = rRect.radii.x;
+  auto radiusY = rRect.radii.y * scaleY;
+  if (fabsf(radiusX - radiusY) > 0.5f) {
+    return nullptr;
+  }
+  auto rect = rRect.rect;
+  rect.scale(1.0f, scaleY);
+  auto cornerRadius = std::min((radiusX + radiusY) * 0.5f,
+                               std::min(rect.width(), rect.height()) * 0.5f);
+  return std::make_shared<RRectBlurMaskFilter>(rect, cornerRadius, sigmaX, scaleY);
+}
+
+std::unique_ptr<FragmentProcessor> RRectBlurMaskFilter::asFragmentProcessor(
+    const FPArgs&, const Matrix* localMatrix) const {
+  auto matrix = Matrix::MakeScale(1.0f, scaleY);
+  if (localMatrix != nullptr) {
+    Matrix invert = {};
+    if (!localMatrix->invert(&invert)) {
+      return nullptr;
+    }
+    matrix.preConcat(invert);
+  }
+  return RRectBlurEffect::Make(rect, cornerRadius, sigma, matrix);
+}
+}  // namespace tgfx
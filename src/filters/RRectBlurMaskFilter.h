@@ -0,0 +1,51 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "tgfx/core/MaskFilter.h"
+#include "tgfx/core/RRect.h"
+
+namespace tgfx {
+/**
+ * A MaskFilter that draws the coverage of a rounded rectangle blurred by a Gaussian, computed
+ * analytically in the fragment shader instead of blurring a rasterized mask.
+ */
+class RRectBlurMaskFilter : public MaskFilter {
+ public:
+  /**
+   * Creates a new RRectBlurMaskFilter. Returns nullptr if either sigma is not positive or if the
+   * corners of the rRect are not circular once the blur is made isotropic.
+   */
+  static std::shared_ptr<MaskFilter> Make(const RRect& rRect, float sigmaX, float sigmaY);
+
+  RRectBlurMaskFilter(const Rect& rect, float cornerRadius, float sigma, float scaleY)
+      : rect(rect), cornerRadius(cornerRadius), sigma(sigma), scaleY(scaleY) {
+  }
+
+ protected:
+  std::unique_ptr<FragmentProcessor> asFragmentProcessor(const FPArgs& args,
+                                                         const Matrix* localMatrix) const override;
+
+ private:
+  Rect rect = Rect::MakeEmpty();
+  float cornerRadius = 0.0f;
+  float sigma = 0.0f;
+  float scaleY = 1.0f;
+};
+}  // namespace tgfx
@@ -0,0 +1,206 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ColorGlyphCache.h"
+#include <cmath>
+#include "gpu/OpContext.h"
+#include "gpu/ops/ClearOp.h"
+#include "gpu/processors/FragmentProcessor.h"
+#include "gpu/proxies/RenderTargetProxy.h"
+#include "utils/Log.h"
+
+namespace tgfx {
+// Each page is a 1024x1024 RGBA texture, so the atlas takes at most 16MB of GPU memory.
+static constexpr int kMaxPageSize = 1024;
+static constexpr size_t kMaxPageCount = 4;
+// Larger glyphs are rare and would waste the atlas space, they are drawn on their own.
+static constexpr int kMaxGlyphSize = 256;
+// The transparent border around each glyph, which keeps the linear sampling of a glyph from
+// picking up its neighbours.
+static constexpr int kGlyphPadding = 1;
+// The number of size buckets per doubling of the text size.
+static constexpr float kBucketsPerOctave = 4.0f;
+
+struct GlyphShelf {
+  int top = 0;
+  int height = 0;
+  int right = 0;
+};
+
+class ColorGlyphPage {
+ public:
+  size_t index = 0;
+  int size = 0;
+  std::shared_ptr<RenderTargetProxy> renderTarget = nullptr;
+  std::unique_ptr<OpContext> opContext = nullptr;
+  std::vector<GlyphShelf> shelves = {};
+  int shelfBottom = 0;
+  std::vector<BytesKey> keys = {};
+  uint64_t lastUseCount = 0;
+
+  bool addRect(int width, int height, Point* location) {
+    GlyphShelf* bestShelf = nullptr;
+    for (auto& shelf : shelves) {
+      if (shelf.height >= height && shelf.right + width <= size &&
+          (bestShelf == nullptr || shelf.height < bestShelf->height)) {
+        bestShelf = &shelf;
+      }
+    }
+    // Opens a new shelf rather than wasting a much taller one, as long as there is room for it.
+    if ((bestShelf == nullptr || bestShelf->height > height + height / 2) &&
+        shelfBottom + height <= size && width <= size) {
+      shelves.push_back({shelfBottom, height, 0});
+      shelfBottom += height;
+      bestShelf = &shelves.back();
+    }
+    if (bestShelf == nullptr) {
+      return false;
+    }
+    location->set(static_cast<float>(bestShelf->right), static_cast<float>(bestShelf->top));
+    bestShelf->right += width;
+    return true;
+  }
+};
+
+float ColorGlyphCache::BucketTextSize(float textSize) {
+  if (textSize <= 0.0f) {
+    return textSize;
+  }
+  auto level = ceilf(log2f(textSize) * kBucketsPerOctave - 1e-3f);
+  return exp2f(level / kBucketsPerOctave);
+}
+
+ColorGlyphCache::ColorGlyphCache(Context* context) : context(context) {
+}
+
+ColorGlyphCache::~ColorGlyphCache() = default;
+
+std::shared_ptr<ColorGlyph> ColorGlyphCache::findOrAddGlyph(const Font& font, GlyphID glyphID,
+                                                            uint32_t renderFlags) {
+  auto typeface = font.getTypeface();
+  if (typeface == nullptr) {
+    return nullptr;
+  }
+  BytesKey bytesKey = {};
+  bytesKey.write(typeface->uniqueID());
+  bytesKey.write(static_cast<uint32_t>(glyphID));
+  bytesKey.write(font.getSize());
+  // Faux styles are applied while rasterizing the glyph, so they must be part of the key as well.
+  uint32_t styleFlags = font.isFauxBold() ? 1 : 0;
+  styleFlags |= font.isFauxItalic() ? 2 : 0;
+  bytesKey.write(styleFlags);
+  useCount++;
+  auto result = glyphs.find(bytesKey);
+  if (result != glyphs.end()) {
+    pages[result->second->pageIndex]->lastUseCount = useCount;
+    return result->second;
+  }
+  if (uncachedGlyphs.count(bytesKey) > 0) {
+    return nullptr;
+  }
+  auto matrix = Matrix::I();
+  auto image = font.getImage(glyphID, &matrix);
+  if (image == nullptr || image->width() > kMaxGlyphSize || image->height() > kMaxGlyphSize) {
+    uncachedGlyphs.insert(std::move(bytesKey));
+    return nullptr;
+  }
+  Point location = {};
+  auto page = addRect(image->width() + kGlyphPadding * 2, image->height() + kGlyphPadding * 2,
+                      &location);
+  if (page == nullptr) {
+    return nullptr;
+  }
+  auto imageRect = Rect::MakeWH(image->width(), image->height());
+  auto atlasRect = imageRect;
+  atlasRect.offset(location.x + kGlyphPadding, location.y + kGlyphPadding);
+  FPArgs args = {context, renderFlags, imageRect, Matrix::I()};
+  auto sampling = SamplingOptions(FilterMode::Nearest);
+  auto processor = FragmentProcessor::Make(std::move(image), args, sampling);
+  if (processor == nullptr) {
+    return nullptr;
+  }
+  page->opContext->fillRectWithFP(atlasRect, std::move(processor),
+                                  Matrix::MakeTrans(-atlasRect.left, -atlasRect.top));
+  page->lastUseCount = useCount;
+  auto glyph = std::make_shared<ColorGlyph>();
+  glyph->textureProxy = page->renderTarget->getTextureProxy();
+  glyph->atlasRect = atlasRect;
+  glyph->matrix = matrix;
+  glyph->pageIndex = page->index;
+  glyphs[bytesKey] = glyph;
+  page->keys.push_back(std::move(bytesKey));
+  return glyph;
+}
+
+ColorGlyphPage* ColorGlyphCache::addRect(int width, int height, Point* location) {
+  for (auto& page : pages) {
+    if (page->addRect(width, height, location)) {
+      return page.get();
+    }
+  }
+  ColorGlyphPage* page = nullptr;
+  if (pages.size() < kMaxPageCount) {
+    pages.push_back(std::make_unique<ColorGlyphPage>());
+    page = pages.back().get();
+    page->index = pages.size() - 1;
+  } else {
+    // All pages are full, evicts the least recently used one. Pending draws keep the texture of
+    // the evicted page alive, since the page gets a new render target.
+    for (auto& item : pages) {
+      if (page == nullptr || item->lastUseCount < page->lastUseCount) {
+        page = item.get();
+      }
+    }
+  }
+  if (!resetPage(page)) {
+    return nullptr;
+  }
+  return page->addRect(width, height, location) ? page : nullptr;
+}
+
+bool ColorGlyphCache::resetPage(ColorGlyphPage* page) {
+  for (auto& key : page->keys) {
+    glyphs.erase(key);
+  }
+  page->keys = {};
+  page->shelves = {};
+  page->shelfBottom = 0;
+  page->opContext = nullptr;
+  page->size = std::min(kMaxPageSize, context->caps()->maxTextureSize);
+  page->renderTarget = RenderTargetProxy::Make(context, page->size, page->size,
+                                               PixelFormat::RGBA_8888);
+  if (page->renderTarget == nullptr) {
+    LOGE("ColorGlyphCache::resetPage() Failed to create the atlas render target!");
+    return false;
+  }
+  page->opContext = std::make_unique<OpContext>(page->renderTarget);
+  auto bounds = Rect::MakeWH(page->size, page->size);
+  page->opContext->addOp(ClearOp::Make(Color::Transparent(), Rect::MakeEmpty(), bounds));
+  return true;
+}
+
+void ColorGlyphCache::releaseAll() {
+  glyphs.clear();
+  uncachedGlyphs.clear();
+  pages.clear();
+}
+
+bool ColorGlyphCache::empty() const {
+  return glyphs.empty() && uncachedGlyphs.empty() && pages.empty();
+}
+}  // namespace tgfx
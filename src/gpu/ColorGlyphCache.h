@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include "gpu/proxies/TextureProxy.h"
+#include "tgfx/core/Font.h"
+#include "tgfx/utils/BytesKey.h"
+
+namespace tgfx {
+class ColorGlyphPage;
+
+/**
+ * ColorGlyph describes where a color glyph image is stored in the atlas of ColorGlyphCache.
+ */
+struct ColorGlyph {
+  /**
+   * The texture of the atlas page holding the glyph image.
+   */
+  std::shared_ptr<TextureProxy> textureProxy = nullptr;
+
+  /**
+   * The bounds of the glyph image in the atlas page.
+   */
+  Rect atlasRect = Rect::MakeEmpty();
+
+  /**
+   * Maps the glyph image to the glyph coordinates of the font it is rasterized with.
+   */
+  Matrix matrix = Matrix::I();
+
+  /**
+   * The index of the atlas page holding the glyph image.
+   */
+  size_t pageIndex = 0;
+};
+
+/**
+ * ColorGlyphCache keeps the images of color glyphs, such as bitmap emoji, in a few atlas textures.
+ * Each glyph is rasterized once per text size bucket and stays in the atlas across frames, so all
+ * glyphs of a run can be drawn from the same texture in one batch.
+ */
+class ColorGlyphCache {
+ public:
+  explicit ColorGlyphCache(Context* context);
+
+  ~ColorGlyphCache();
+
+  /**
+   * Rounds the text size up to the nearest size bucket. Glyphs are rasterized at bucket sizes and
+   * scaled down slightly when drawn, so zooming text does not rasterize its glyphs at every frame.
+   */
+  static float BucketTextSize(float textSize);
+
+  /**
+   * Finds the glyph of the font in the atlas, rasterizing it into the atlas if it is not there
+   * yet. Returns nullptr if the glyph has no image or is too large for the atlas.
+   */
+  std::shared_ptr<ColorGlyph> findOrAddGlyph(const Font& font, GlyphID glyphID,
+                                             uint32_t renderFlags);
+
+  void releaseAll();
+
+  bool empty() const;
+
+ private:
+  Context* context = nullptr;
+  uint64_t useCount = 0;
+  std::vector<std::unique_ptr<ColorGlyphPage>> pages;
+  BytesKeyMap<std::shared_ptr<ColorGlyph>> glyphs = {};
+  // The keys of glyphs that have no image or are too large for the atlas, so they are not
+  // rasterized again only to find out that they can not be cached.
+  std::unordered_set<BytesKey, BytesKeyHasher> uncachedGlyphs = {};
+
+  ColorGlyphPage* addRect(int width, int height, Point* location);
+
+  bool resetPage(ColorGlyphPage* page);
+};
+}  // namespace tgfx
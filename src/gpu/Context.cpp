@@ -22,6 +22,7 @@
 #include "gpu/ProxyProvider.h"
 #include "gpu/ResourceCache.h"
 #include "gpu/ResourceProvider.h"
+#include "gpu/ShareGroup.h"
 #include "tgfx/utils/Clock.h"
 #include "utils/Log.h"
 
@@ -45,6 +46,9 @@ Context::~Context() {
   delete _gpu;
   delete _resourceProvider;
   delete _proxyProvider;
+  if (_shareGroup != nullptr) {
+    _shareGroup->removeContext();
+  }
 }
 
 bool Context::flush(BackendSemaphore* signalSemaphore) {
@@ -86,7 +90,11 @@ bool Context::wait(const BackendSemaphore& waitSemaphore) {
   if (semaphore == nullptr) {
     return false;
   }
-  return caps()->semaphoreSupport && _gpu->waitSemaphore(semaphore.get());
+  if (!caps()->semaphoreSupport || !_gpu->waitSemaphore(semaphore.get())) {
+    return false;
+  }
+  _gpu->deleteSemaphore(semaphore.get());
+  return true;
 }
 
 size_t Context::memoryUsage() const {
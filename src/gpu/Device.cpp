@@ -32,6 +32,9 @@ Device::~Device() {
 }
 
 Context* Device::lockContext() {
+  if (isPinnedToCurrentThread()) {
+    return context;
+  }
   locker.lock();
   contextLocked = onLockContext();
   if (!contextLocked) {
@@ -42,6 +45,9 @@ Context* Device::lockContext() {
 }
 
 void Device::unlock() {
+  if (isPinnedToCurrentThread()) {
+    return;
+  }
   if (contextLocked) {
     contextLocked = false;
     onUnlockContext();
@@ -49,7 +55,45 @@ void Device::unlock() {
   locker.unlock();
 }
 
+bool Device::pinToCurrentThread() {
+  if (isPinnedToCurrentThread()) {
+    return true;
+  }
+  // Claims the pin before waiting for the lock, so a thread that is pinning the device is seen by
+  // other threads immediately, and they never wait for a lock that is held indefinitely.
+  auto noThread = std::thread::id();
+  if (!pinnedThread.compare_exchange_strong(noThread, std::this_thread::get_id(),
+                                            std::memory_order_acq_rel)) {
+    return false;
+  }
+  locker.lock();
+  contextLocked = onLockContext();
+  if (!contextLocked) {
+    pinnedThread.store(std::thread::id(), std::memory_order_release);
+    locker.unlock();
+    return false;
+  }
+  return true;
+}
+
+void Device::unpin() {
+  if (!isPinnedToCurrentThread()) {
+    return;
+  }
+  pinnedThread.store(std::thread::id(), std::memory_order_release);
+  unlock();
+}
+
 void Device::releaseAll() {
+  unpin();
+  if (pinnedThread.load(std::memory_order_acquire) != std::thread::id()) {
+    // The lock is held by the pinned thread and can only be released there, waiting for it would
+    // deadlock.
+    LOGE("Device::releaseAll() The device is still pinned to another thread, call unpin() on that "
+         "thread first!");
+    DEBUG_ASSERT(false);
+    return;
+  }
   std::lock_guard<std::mutex> autoLock(locker);
   if (context == nullptr) {
     return;
@@ -57,6 +57,8 @@ class Gpu {
 
   virtual bool waitSemaphore(const Semaphore* semaphore) = 0;
 
+  virtual void deleteSemaphore(Semaphore* semaphore) = 0;
+
   virtual bool submitToGpu(bool syncCpu) = 0;
 
   virtual void submit(RenderPass* renderPass) = 0;
@@ -19,6 +19,7 @@
 #include "ProxyProvider.h"
 #include "gpu/DrawingManager.h"
 #include "gpu/PlainTexture.h"
+#include "gpu/ShareGroup.h"
 #include "gpu/proxies/TextureRenderTargetProxy.h"
 #include "gpu/tasks/GpuBufferCreateTask.h"
 #include "gpu/tasks/RenderTargetCreateTask.h"
@@ -239,6 +240,9 @@ std::shared_ptr<TextureProxy> ProxyProvider::findTextureProxy(const UniqueKey& u
     return proxy;
   }
   auto texture = Resource::Find<Texture>(context, uniqueKey);
+  if (texture == nullptr && context->shareGroup() != nullptr) {
+    texture = context->shareGroup()->findTexture(context, uniqueKey);
+  }
   if (texture == nullptr) {
     return nullptr;
   }
@@ -20,13 +20,13 @@
 
 namespace tgfx {
 Quad Quad::MakeFromRect(const Rect& rect, const Matrix& matrix) {
-  std::vector<Point> points;
-  points.push_back(Point::Make(rect.left, rect.top));
-  points.push_back(Point::Make(rect.left, rect.bottom));
-  points.push_back(Point::Make(rect.right, rect.top));
-  points.push_back(Point::Make(rect.right, rect.bottom));
-  matrix.mapPoints(points.data(), 4);
-  return Quad(points);
+  Quad quad = {};
+  quad.points[0].set(rect.left, rect.top);
+  quad.points[1].set(rect.left, rect.bottom);
+  quad.points[2].set(rect.right, rect.top);
+  quad.points[3].set(rect.right, rect.bottom);
+  matrix.mapPoints(quad.points.data(), 4);
+  return quad;
 }
 
 Rect Quad::bounds() const {
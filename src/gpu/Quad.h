@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <array>
 #include "tgfx/core/Matrix.h"
 #include "tgfx/core/Rect.h"
 
@@ -33,9 +34,8 @@ class Quad {
   Rect bounds() const;
 
  private:
-  explicit Quad(std::vector<Point> points) : points(std::move(points)) {
-  }
+  Quad() = default;
 
-  std::vector<Point> points;
+  std::array<Point, 4> points = {};
 };
 }  // namespace tgfx
@@ -17,19 +17,29 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "RenderContext.h"
+#include "core/MaskTileGrid.h"
 #include "core/PathRef.h"
 #include "core/Rasterizer.h"
+#include "core/Records.h"
+#include "core/ScalerContext.h"
 #include "core/SimpleTextBlob.h"
+#include "filters/DropShadowImageFilter.h"
+#include "filters/RRectBlurMaskFilter.h"
+#include "gpu/ColorGlyphCache.h"
 #include "gpu/DrawingManager.h"
 #include "gpu/OpContext.h"
 #include "gpu/ProxyProvider.h"
+#include "gpu/ResourceProvider.h"
 #include "gpu/ops/ClearOp.h"
+#include "gpu/ops/ConvexPathOp.h"
 #include "gpu/ops/FillRectOp.h"
 #include "gpu/ops/RRectOp.h"
 #include "gpu/ops/TriangulatingPathOp.h"
+#include "gpu/ops/VerticesOp.h"
 #include "gpu/processors/AARectEffect.h"
 #include "gpu/processors/TextureEffect.h"
 #include "images/TextureImage.h"
+#include "tgfx/core/PathEffect.h"
 #include "utils/StrokeKey.h"
 
 namespace tgfx {
@@ -38,6 +48,8 @@ static constexpr int AA_TESSELLATOR_MAX_VERB_COUNT = 100;
 // A factor used to estimate the memory size of a tessellated path, based on the average value of
 // Buffer.size() / Path.countPoints() from 4300+ tessellated path data.
 static constexpr int AA_TESSELLATOR_BUFFER_SIZE_FACTOR = 170;
+// Masks larger than four tiles of this size are rasterized as sparse tiles.
+static constexpr int MASK_TILE_SIZE = 256;
 /**
  * Defines the maximum distance a draw can extend beyond a clip's boundary and still be considered
  * 'on the other side'. This tolerance accounts for potential floating point rounding errors. The
@@ -102,7 +114,26 @@ void RenderContext::drawRect(const Rect& rect, const MCState& state, const FillS
     return;
   }
   auto drawOp = FillRectOp::Make(style.color, localBounds, state.matrix);
-  addDrawOp(std::move(drawOp), localBounds, state, style);
+  addDrawOp(std::move(drawOp), localBounds, state, style, true);
+}
+
+void RenderContext::drawRects(const std::vector<Rect>& rects, const MCState& state,
+                              const FillStyle& style) {
+  auto maxCount = static_cast<size_t>(ResourceProvider::MaxNumQuadsPerDraw());
+  for (size_t offset = 0; offset < rects.size(); offset += maxCount) {
+    auto count = std::min(maxCount, rects.size() - offset);
+    auto bounds = Rect::MakeEmpty();
+    for (size_t i = offset; i < offset + count; i++) {
+      bounds.join(rects[i]);
+    }
+    auto localBounds = clipLocalBounds(bounds, state);
+    if (localBounds.isEmpty()) {
+      continue;
+    }
+    auto drawOp = FillRectOp::Make(style.color, rects.data() + offset, count, state.matrix);
+    // The rects of a batch may have gaps between them, so only a single rect covers localBounds.
+    addDrawOp(std::move(drawOp), localBounds, state, style, count == 1);
+  }
 }
 
 static bool HasColorOnly(const FillStyle& style) {
@@ -128,11 +159,15 @@ bool RenderContext::drawAsClear(const Rect& rect, const MCState& state, const Fi
     auto format = opContext->renderTarget()->format();
     const auto& writeSwizzle = getContext()->caps()->getWriteSwizzle(format);
     color = writeSwizzle.applyTo(color);
+    auto deviceBounds = bounds;
+    if (!deviceBounds.intersect(getClipBounds(state.clip))) {
+      return true;
+    }
     if (useScissor) {
-      addOp(ClearOp::Make(color, *clipRect), [] { return false; });
+      addOp(ClearOp::Make(color, *clipRect, deviceBounds), deviceBounds, [] { return false; });
       return true;
     } else if (clipRect->isEmpty()) {
-      addOp(ClearOp::Make(color, bounds), [] { return true; });
+      addOp(ClearOp::Make(color, bounds, deviceBounds), deviceBounds, [] { return true; });
       return true;
     }
   }
@@ -148,6 +183,24 @@ void RenderContext::drawRRect(const RRect& rRect, const MCState& state, const Fi
   addDrawOp(std::move(drawOp), localBounds, state, style);
 }
 
+void RenderContext::drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                               const FillStyle& style) {
+  auto maxCount = RRectOp::MaxNumRRects();
+  for (size_t offset = 0; offset < rRects.size(); offset += maxCount) {
+    auto count = std::min(maxCount, rRects.size() - offset);
+    auto bounds = Rect::MakeEmpty();
+    for (size_t i = offset; i < offset + count; i++) {
+      bounds.join(rRects[i].rect);
+    }
+    auto localBounds = clipLocalBounds(bounds, state);
+    if (localBounds.isEmpty()) {
+      continue;
+    }
+    auto drawOp = RRectOp::Make(style.color, rRects.data() + offset, count, state.matrix);
+    addDrawOp(std::move(drawOp), localBounds, state, style);
+  }
+}
+
 static bool ShouldTriangulatePath(const Path& path, const Matrix& viewMatrix) {
   if (path.countVerbs() <= AA_TESSELLATOR_MAX_VERB_COUNT) {
     return true;
@@ -171,8 +224,12 @@ void RenderContext::drawPath(const Path& path, const MCState& state, const FillS
     return;
   }
   std::unique_ptr<DrawOp> drawOp = nullptr;
-  if (ShouldTriangulatePath(path, state.matrix)) {
+  if (stroke == nullptr && ConvexPathOp::CanDraw(path)) {
+    drawOp = ConvexPathOp::Make(style.color, path, state.matrix, renderFlags);
+  } else if (ShouldTriangulatePath(path, state.matrix)) {
     drawOp = TriangulatingPathOp::Make(style.color, path, state.matrix, stroke, renderFlags);
+  } else if (drawAsTiledMask(path, state, style, stroke, localBounds)) {
+    return;
   } else {
     auto maskFP = makeTextureMask(path, state.matrix, stroke);
     if (maskFP != nullptr) {
@@ -224,6 +281,96 @@ std::unique_ptr<FragmentProcessor> RenderContext::makeTextureMask(const Path& pa
   return CreateMaskFP(std::move(textureProxy), &rasterizeMatrix);
 }
 
+bool RenderContext::drawAsTiledMask(const Path& path, const MCState& state,
+                                    const FillStyle& style, const Stroke* stroke,
+                                    const Rect& localBounds) {
+  if (path.isInverseFillType()) {
+    return false;
+  }
+  auto scales = state.matrix.getAxisScales();
+  auto bounds = path.getBounds();
+  if (stroke != nullptr) {
+    bounds.outset(stroke->width, stroke->width);
+  }
+  bounds.scale(scales.x, scales.y);
+  auto width = static_cast<int>(ceilf(bounds.width()));
+  auto height = static_cast<int>(ceilf(bounds.height()));
+  if (width * height <= MASK_TILE_SIZE * MASK_TILE_SIZE * 4) {
+    return false;
+  }
+  auto fillPath = path;
+  if (stroke != nullptr) {
+    auto effect = PathEffect::MakeStroke(stroke);
+    if (effect == nullptr) {
+      return false;
+    }
+    effect->applyTo(&fillPath);
+  }
+  auto rasterizeMatrix = Matrix::MakeScale(scales.x, scales.y);
+  rasterizeMatrix.postTranslate(-bounds.x(), -bounds.y());
+  auto maskPath = fillPath;
+  maskPath.transform(rasterizeMatrix);
+  MaskTileGrid grid(maskPath, width, height, MASK_TILE_SIZE);
+  Matrix invertMatrix = {};
+  if (!rasterizeMatrix.invert(&invertMatrix)) {
+    return false;
+  }
+  // The tiles adjoin each other, and the masks already antialias the edges of the path.
+  auto tileStyle = style;
+  tileStyle.antiAlias = false;
+  static const auto TiledPathType = UniqueID::Next();
+  auto pathKey = PathRef::GetUniqueKey(path);
+  std::vector<Rect> fullRects = {};
+  for (int row = 0; row < grid.rows(); row++) {
+    for (int column = 0; column < grid.columns(); column++) {
+      auto coverage = grid.coverage(column, row);
+      if (coverage == TileCoverage::None) {
+        continue;
+      }
+      auto tileRect = grid.getTileRect(column, row);
+      auto tileBounds = invertMatrix.mapRect(tileRect);
+      if (!tileBounds.intersect(localBounds)) {
+        continue;
+      }
+      if (coverage == TileCoverage::Full) {
+        fullRects.push_back(tileBounds);
+        continue;
+      }
+      BytesKey bytesKey(5 + (stroke ? StrokeKeyCount : 0));
+      bytesKey.write(TiledPathType);
+      bytesKey.write(scales.x);
+      bytesKey.write(scales.y);
+      bytesKey.write(static_cast<uint32_t>(column));
+      bytesKey.write(static_cast<uint32_t>(row));
+      if (stroke) {
+        WriteStrokeKey(&bytesKey, stroke);
+      }
+      auto uniqueKey = UniqueKey::Combine(pathKey, bytesKey);
+      auto tileMatrix = rasterizeMatrix;
+      tileMatrix.postTranslate(-tileRect.x(), -tileRect.y());
+      auto tileSize = ISize::Make(static_cast<int>(tileRect.width()),
+                                  static_cast<int>(tileRect.height()));
+      auto rasterizer = Rasterizer::MakeFrom(fillPath, tileSize, tileMatrix);
+      auto proxyProvider = getContext()->proxyProvider();
+      auto textureProxy =
+          proxyProvider->createTextureProxy(uniqueKey, rasterizer, false, renderFlags);
+      auto maskFP = CreateMaskFP(std::move(textureProxy), &tileMatrix);
+      if (maskFP == nullptr) {
+        continue;
+      }
+      auto drawOp = FillRectOp::Make(style.color, tileBounds, state.matrix);
+      drawOp->addCoverageFP(std::move(maskFP));
+      addDrawOp(std::move(drawOp), tileBounds, state, tileStyle);
+    }
+  }
+  if (!fullRects.empty()) {
+    auto drawOp =
+        FillRectOp::Make(style.color, fullRects.data(), fullRects.size(), state.matrix);
+    addDrawOp(std::move(drawOp), localBounds, state, tileStyle);
+  }
+  return true;
+}
+
 void RenderContext::drawImageRect(std::shared_ptr<Image> image, const SamplingOptions& sampling,
                                   const Rect& rect, const MCState& state, const FillStyle& style) {
   if (image == nullptr) {
@@ -250,6 +397,76 @@ void RenderContext::drawImageRect(std::shared_ptr<Image> image, const SamplingOp
   }
 }
 
+void RenderContext::drawImagePatches(std::shared_ptr<Image> image,
+                                     const SamplingOptions& sampling,
+                                     const std::vector<ImagePatch>& patches, const MCState& state,
+                                     const FillStyle& style) {
+  if (image == nullptr || patches.empty()) {
+    return;
+  }
+  std::vector<Rect> rects = {};
+  std::vector<Matrix> localMatrices = {};
+  rects.reserve(patches.size());
+  localMatrices.reserve(patches.size());
+  auto dstBounds = Rect::MakeEmpty();
+  auto srcBounds = Rect::MakeEmpty();
+  for (auto& patch : patches) {
+    if (patch.src.isEmpty() || patch.dst.isEmpty()) {
+      continue;
+    }
+    // Maps the destination rect to the source rect, which is in the local space of the image.
+    auto scaleX = patch.src.width() / patch.dst.width();
+    auto scaleY = patch.src.height() / patch.dst.height();
+    localMatrices.push_back(Matrix::MakeAll(scaleX, 0, patch.src.left - patch.dst.left * scaleX,
+                                            0, scaleY, patch.src.top - patch.dst.top * scaleY));
+    rects.push_back(patch.dst);
+    dstBounds.join(patch.dst);
+    srcBounds.join(patch.src);
+  }
+  if (rects.empty() || rects.size() > ResourceProvider::MaxNumQuadsPerDraw()) {
+    return;
+  }
+  auto localBounds = clipLocalBounds(dstBounds, state);
+  if (localBounds.isEmpty()) {
+    return;
+  }
+  auto isAlphaOnly = image->isAlphaOnly();
+  if (style.maskFilter || (isAlphaOnly && style.shader)) {
+    // The shader and the mask filter are sampled in the local coordinates of the op, which must
+    // stay in the destination space, so each patch gets its own op with the mapping on its image.
+    for (size_t i = 0; i < rects.size(); i++) {
+      auto cellBounds = clipLocalBounds(rects[i], state);
+      if (cellBounds.isEmpty()) {
+        continue;
+      }
+      FPArgs args = {getContext(), renderFlags, cellBounds, state.matrix};
+      auto processor = FragmentProcessor::Make(image, args, sampling, &localMatrices[i]);
+      if (processor == nullptr) {
+        continue;
+      }
+      auto drawOp = FillRectOp::MakeGridCell(style.color, rects[i], dstBounds, state.matrix);
+      drawOp->addColorFP(std::move(processor));
+      addDrawOp(std::move(drawOp), cellBounds, state, style);
+    }
+    return;
+  }
+  FPArgs args = {getContext(), renderFlags, srcBounds, state.matrix};
+  auto processor = FragmentProcessor::Make(std::move(image), args, sampling);
+  if (processor == nullptr) {
+    return;
+  }
+  auto drawOp = FillRectOp::MakeGrid(style.color, rects.data(), localMatrices.data(),
+                                     rects.size(), state.matrix);
+  drawOp->addColorFP(std::move(processor));
+  if (!isAlphaOnly && style.shader) {
+    auto fillStyle = style;
+    fillStyle.shader = nullptr;
+    addDrawOp(std::move(drawOp), localBounds, state, fillStyle);
+  } else {
+    addDrawOp(std::move(drawOp), localBounds, state, style);
+  }
+}
+
 void RenderContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                                  const Stroke* stroke) {
   if (glyphRun.empty()) {
@@ -290,11 +507,36 @@ void RenderContext::drawGlyphRun(GlyphRun glyphRun, const MCState& state, const
   addDrawOp(std::move(drawOp), localBounds, state, style);
 }
 
+void RenderContext::drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                                 const FillStyle& style) {
+  auto localBounds = clipLocalBounds(vertices->bounds(), state);
+  if (localBounds.isEmpty()) {
+    return;
+  }
+  // Meshes are drawn without analytic antialiasing.
+  auto meshStyle = style;
+  meshStyle.antiAlias = false;
+  auto drawOp = VerticesOp::Make(style.color, std::move(vertices), state.matrix);
+  addDrawOp(std::move(drawOp), localBounds, state, meshStyle);
+}
+
 void RenderContext::drawLayer(std::shared_ptr<Picture> picture, const MCState& state,
                               const FillStyle& style, std::shared_ptr<ImageFilter> filter) {
+  auto clipBounds = getClipBounds(state.clip);
+  if (clipBounds.isEmpty()) {
+    return;
+  }
+  if (drawAsShadow(picture.get(), state, style, filter.get())) {
+    return;
+  }
   auto bounds = picture->getBounds(state.matrix);
-  auto width = static_cast<int>(ceilf(bounds.width()));
-  auto height = static_cast<int>(ceilf(bounds.height()));
+  auto inputBounds = filter ? filter->filterBounds(clipBounds, MapDirection::Reverse) : clipBounds;
+  if (!bounds.intersect(inputBounds)) {
+    return;
+  }
+  bounds.roundOut();
+  auto width = static_cast<int>(bounds.width());
+  auto height = static_cast<int>(bounds.height());
   auto renderTarget = opContext->renderTarget()->makeRenderTargetProxy(width, height);
   if (renderTarget == nullptr) {
     return;
@@ -316,34 +558,211 @@ void RenderContext::drawLayer(std::shared_ptr<Picture> picture, const MCState& s
   drawState.matrix = Matrix::MakeTrans(bounds.x(), bounds.y());
   if (filter) {
     auto offset = Point::Zero();
-    image = image->makeWithFilter(std::move(filter), &offset);
+    // Only the part of the filtered image that lands inside the clip needs to be generated.
+    auto filterClip = clipBounds;
+    filterClip.offset(-bounds.x(), -bounds.y());
+    image = image->makeWithFilter(std::move(filter), &offset, &filterClip);
     if (image == nullptr) {
       return;
     }
     drawState.matrix.preTranslate(offset.x, offset.y);
   }
-  drawImageRect(std::move(image), {}, bounds, drawState, style);
+  auto rect = Rect::MakeWH(image->width(), image->height());
+  drawImageRect(std::move(image), {}, rect, drawState, style);
+}
+
+static bool GetSimpleShape(const Record* record, RRect* rRect, const MCState** state,
+                           const FillStyle** style) {
+  switch (record->type()) {
+    case RecordType::DrawRect: {
+      auto drawRect = static_cast<const DrawRect*>(record);
+      rRect->rect = drawRect->rect;
+      rRect->radii = Point::Zero();
+      *state = &drawRect->state;
+      *style = &drawRect->style;
+      return true;
+    }
+    case RecordType::DrawRRect: {
+      auto drawRRect = static_cast<const DrawRRect*>(record);
+      *rRect = drawRRect->rRect;
+      *state = &drawRRect->state;
+      *style = &drawRRect->style;
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+bool RenderContext::drawAsShadow(const Picture* picture, const MCState& state,
+                                 const FillStyle& style, const ImageFilter* filter) {
+  if (picture->records.size() != 1) {
+    return false;
+  }
+  auto shadowFilter = DropShadowImageFilter::Cast(filter);
+  if (shadowFilter == nullptr || shadowFilter->blurFilter == nullptr) {
+    return false;
+  }
+  // The shadow and the shape are drawn separately, which matches compositing the whole layer only
+  // if the layer style leaves them unchanged or if there is just the shadow to draw.
+  if (style.blendMode != BlendMode::SrcOver || style.shader || style.maskFilter) {
+    return false;
+  }
+  if (!shadowFilter->shadowOnly && (style.color.alpha != 1.0f || style.colorFilter)) {
+    return false;
+  }
+  RRect rRect = {};
+  const MCState* shapeState = nullptr;
+  const FillStyle* shapeStyle = nullptr;
+  if (!GetSimpleShape(picture->records[0], &rRect, &shapeState, &shapeStyle)) {
+    return false;
+  }
+  auto& shapeClip = shapeState->clip;
+  if (!shapeClip.isEmpty() || !shapeClip.isInverseFillType() ||
+      shapeStyle->blendMode != BlendMode::SrcOver || shapeStyle->shader ||
+      shapeStyle->colorFilter || shapeStyle->maskFilter) {
+    return false;
+  }
+  // The filter runs in device space, so the shape has to stay an axis-aligned rrect there.
+  auto viewMatrix = state.matrix * shapeState->matrix;
+  if (viewMatrix.getSkewX() != 0.0f || viewMatrix.getSkewY() != 0.0f) {
+    return false;
+  }
+  auto shadowRRect = rRect;
+  shadowRRect.rect = viewMatrix.mapRect(rRect.rect);
+  shadowRRect.radii.x *= fabsf(viewMatrix.getScaleX());
+  shadowRRect.radii.y *= fabsf(viewMatrix.getScaleY());
+  shadowRRect.rect.offset(shadowFilter->dx, shadowFilter->dy);
+  // Picks the Gaussian whose 3-sigma extent matches the bounds of the dual blur it replaces, so
+  // the shadow covers the same area the filter reports.
+  auto blurBounds = shadowFilter->blurExtent();
+  auto maskFilter = RRectBlurMaskFilter::Make(shadowRRect, -blurBounds.left / 3.0f,
+                                              -blurBounds.top / 3.0f);
+  if (maskFilter == nullptr) {
+    return false;
+  }
+  auto shadowColor = shadowFilter->color;
+  shadowColor.alpha *= shapeStyle->color.alpha;
+  FillStyle shadowStyle = {};
+  shadowStyle.maskFilter = std::move(maskFilter);
+  if (shadowFilter->shadowOnly) {
+    shadowColor.alpha *= style.color.alpha;
+    shadowStyle.colorFilter = style.colorFilter;
+  }
+  shadowStyle.color = shadowColor.premultiply();
+  auto shadowState = state;
+  shadowState.matrix = Matrix::I();
+  auto shadowBounds = shadowRRect.rect;
+  shadowBounds.left += blurBounds.left;
+  shadowBounds.top += blurBounds.top;
+  shadowBounds.right += blurBounds.right;
+  shadowBounds.bottom += blurBounds.bottom;
+  drawRect(shadowBounds, shadowState, shadowStyle);
+  if (!shadowFilter->shadowOnly) {
+    picture->playback(this, state);
+  }
+  return true;
 }
 
+/**
+ * The glyphs of a run that are stored in the same atlas page of ColorGlyphCache.
+ */
+struct ColorGlyphBatch {
+  std::shared_ptr<TextureProxy> textureProxy = nullptr;
+  std::vector<Rect> rects = {};
+  std::vector<Rect> localRects = {};
+  std::vector<Matrix> viewMatrices = {};
+  std::vector<Matrix> localMatrices = {};
+};
+
 void RenderContext::drawColorGlyphs(const GlyphRun& glyphRun, const MCState& state,
                                     const FillStyle& style) {
   auto viewMatrix = state.matrix;
   auto scale = viewMatrix.getMaxScale();
+  if (scale <= 0.0f) {
+    return;
+  }
   viewMatrix.preScale(1.0f / scale, 1.0f / scale);
   auto font = glyphRun.font();
   font = font.makeWithSize(font.getSize() * scale);
   auto glyphCount = glyphRun.runSize();
   auto& glyphIDs = glyphRun.glyphIDs();
   auto& positions = glyphRun.positions();
+  std::vector<size_t> looseGlyphs = {};
+  std::vector<ColorGlyphBatch> batches = {};
+  // Mask filters work in the local space of each glyph image, so those glyphs are drawn one by one.
+  if (style.maskFilter == nullptr) {
+    auto glyphCache = getContext()->resourceProvider()->colorGlyphCache();
+    auto bucketFont = font.makeWithSize(ColorGlyphCache::BucketTextSize(font.getSize()));
+    bucketFont.setFauxItalic(false);
+    auto sizeScale = font.getSize() / bucketFont.getSize();
+    for (size_t i = 0; i < glyphCount; ++i) {
+      auto glyph = glyphCache->findOrAddGlyph(bucketFont, glyphIDs[i], renderFlags);
+      if (glyph == nullptr) {
+        looseGlyphs.push_back(i);
+        continue;
+      }
+      auto batch = std::find_if(batches.begin(), batches.end(), [&](const ColorGlyphBatch& item) {
+        return item.textureProxy == glyph->textureProxy;
+      });
+      if (batch == batches.end()) {
+        batch = batches.insert(batches.end(), ColorGlyphBatch{});
+        batch->textureProxy = glyph->textureProxy;
+      }
+      auto glyphMatrix = glyph->matrix;
+      glyphMatrix.postScale(sizeScale, sizeScale);
+      if (font.isFauxItalic()) {
+        glyphMatrix.postSkew(ITALIC_SKEW, 0);
+      }
+      glyphMatrix.postTranslate(positions[i].x * scale, positions[i].y * scale);
+      auto rect = Rect::MakeWH(glyph->atlasRect.width(), glyph->atlasRect.height());
+      auto localMatrix = glyphMatrix;
+      localMatrix.postScale(1.0f / scale, 1.0f / scale);
+      glyphMatrix.postConcat(viewMatrix);
+      batch->rects.push_back(rect);
+      batch->localRects.push_back(localMatrix.mapRect(rect));
+      batch->viewMatrices.push_back(glyphMatrix);
+      batch->localMatrices.push_back(
+          Matrix::MakeTrans(glyph->atlasRect.left, glyph->atlasRect.top));
+    }
+  } else {
+    for (size_t i = 0; i < glyphCount; ++i) {
+      looseGlyphs.push_back(i);
+    }
+  }
+  auto maxCount = static_cast<size_t>(ResourceProvider::MaxNumQuadsPerDraw());
+  auto fillStyle = style;
+  fillStyle.shader = nullptr;
+  for (auto& batch : batches) {
+    for (size_t offset = 0; offset < batch.rects.size(); offset += maxCount) {
+      auto count = std::min(maxCount, batch.rects.size() - offset);
+      auto bounds = Rect::MakeEmpty();
+      for (size_t i = offset; i < offset + count; i++) {
+        bounds.join(batch.localRects[i]);
+      }
+      auto localBounds = clipLocalBounds(bounds, state);
+      if (localBounds.isEmpty()) {
+        continue;
+      }
+      auto processor = TextureEffect::Make(batch.textureProxy);
+      if (processor == nullptr) {
+        continue;
+      }
+      auto drawOp =
+          FillRectOp::Make(style.color, batch.rects.data() + offset,
+                           batch.viewMatrices.data() + offset, batch.localMatrices.data() + offset,
+                           count);
+      drawOp->addColorFP(std::move(processor));
+      addDrawOp(std::move(drawOp), localBounds, state, fillStyle);
+    }
+  }
   auto glyphState = state;
-  for (size_t i = 0; i < glyphCount; ++i) {
-    const auto& glyphID = glyphIDs[i];
-    const auto& position = positions[i];
-    auto glyphImage = font.getImage(glyphID, &glyphState.matrix);
+  for (auto index : looseGlyphs) {
+    auto glyphImage = font.getImage(glyphIDs[index], &glyphState.matrix);
     if (glyphImage == nullptr) {
       continue;
     }
-    glyphState.matrix.postTranslate(position.x * scale, position.y * scale);
+    glyphState.matrix.postTranslate(positions[index].x * scale, positions[index].y * scale);
     glyphState.matrix.postConcat(viewMatrix);
     auto rect = Rect::MakeWH(glyphImage->width(), glyphImage->height());
     drawImageRect(std::move(glyphImage), {}, rect, glyphState, style);
@@ -391,6 +810,20 @@ std::pair<std::optional<Rect>, bool> RenderContext::getClipRect(const Path& clip
   return {{}, false};
 }
 
+Rect RenderContext::getClipBounds(const Path& clip) {
+  auto renderTarget = opContext->renderTarget();
+  auto bounds = Rect::MakeWH(renderTarget->width(), renderTarget->height());
+  if (clip.isInverseFillType()) {
+    return bounds;
+  }
+  auto clipBounds = clip.getBounds();
+  clipBounds.roundOut();
+  if (!bounds.intersect(clipBounds)) {
+    return Rect::MakeEmpty();
+  }
+  return bounds;
+}
+
 std::shared_ptr<TextureProxy> RenderContext::getClipTexture(const Path& clip) {
   auto domainID = PathRef::GetUniqueKey(clip).domainID();
   if (domainID == clipID) {
@@ -460,7 +893,7 @@ std::unique_ptr<FragmentProcessor> RenderContext::getClipMask(const Path& clip,
 }
 
 void RenderContext::addDrawOp(std::unique_ptr<DrawOp> op, const Rect& localBounds,
-                              const MCState& state, const FillStyle& style) {
+                              const MCState& state, const FillStyle& style, bool isOpaqueFill) {
   if (op == nullptr) {
     return;
   }
@@ -470,7 +903,8 @@ void RenderContext::addDrawOp(std::unique_ptr<DrawOp> op, const Rect& localBound
   if (opContext->renderTarget()->sampleCount() > 1) {
     aaType = AAType::MSAA;
   } else if (style.antiAlias) {
-    if (!isRectOp || !args.viewMatrix.rectStaysRect() || !IsPixelAligned(op->bounds())) {
+    if (!isRectOp || !args.viewMatrix.rectStaysRect() ||
+        !static_cast<FillRectOp*>(op.get())->isPixelAligned()) {
       aaType = AAType::Coverage;
     }
   }
@@ -501,12 +935,31 @@ void RenderContext::addDrawOp(std::unique_ptr<DrawOp> op, const Rect& localBound
     op->addCoverageFP(std::move(clipMask));
   }
   op->setScissorRect(scissorRect);
-  addOp(std::move(op), [&] { return wouldOverwriteEntireRT(localBounds, state, style, isRectOp); });
+  auto deviceBounds = op->bounds();
+  if (aaType == AAType::Coverage) {
+    // Analytic anti-aliasing may touch the pixels just outside the geometry bounds.
+    deviceBounds.outset(1.0f, 1.0f);
+  }
+  deviceBounds.roundOut();
+  if (!deviceBounds.intersect(getClipBounds(state.clip))) {
+    return;
+  }
+  // Image and mask FPs added by the callers are not described by the style and may leave any pixel
+  // translucent, so only plain fills can hide the ops underneath.
+  if (isOpaqueFill) {
+    op->setOpaqueBounds(getOpaqueBounds(localBounds, state, style));
+  }
+  addOp(std::move(op), deviceBounds,
+        [&] { return wouldOverwriteEntireRT(localBounds, state, style, isOpaqueFill); });
 }
 
-void RenderContext::addOp(std::unique_ptr<Op> op, const std::function<bool()>& willDiscardContent) {
-  if (surface && !surface->aboutToDraw(willDiscardContent)) {
-    return;
+void RenderContext::addOp(std::unique_ptr<Op> op, const Rect& deviceBounds,
+                          const std::function<bool()>& willDiscardContent) {
+  if (surface) {
+    if (!surface->aboutToDraw(deviceBounds, willDiscardContent)) {
+      return;
+    }
+    surface->damagedBounds.join(deviceBounds);
   }
   opContext->addOp(std::move(op));
 }
@@ -551,30 +1004,43 @@ static bool BlendModeIsOpaque(BlendMode mode, SrcColorOpacity opacityType) {
 }
 
 bool RenderContext::wouldOverwriteEntireRT(const Rect& localBounds, const MCState& state,
-                                           const FillStyle& style, bool isRectOp) const {
-  if (!isRectOp) {
+                                           const FillStyle& style, bool isOpaqueFill) const {
+  if (!isOpaqueFill) {
     return false;
   }
+  auto renderTarget = opContext->renderTarget();
+  auto rtRect = Rect::MakeWH(renderTarget->width(), renderTarget->height());
+  return getOpaqueBounds(localBounds, state, style).contains(rtRect);
+}
+
+Rect RenderContext::getOpaqueBounds(const Rect& localBounds, const MCState& state,
+                                    const FillStyle& style) const {
   auto& clip = state.clip;
   auto& viewMatrix = state.matrix;
-  auto clipRect = Rect::MakeEmpty();
-  if (!clip.isRect(&clipRect) || !viewMatrix.rectStaysRect()) {
-    return false;
-  }
   auto renderTarget = opContext->renderTarget();
   auto rtRect = Rect::MakeWH(renderTarget->width(), renderTarget->height());
-  if (clipRect != rtRect) {
-    return false;
+  auto clipRect = Rect::MakeEmpty();
+  if (clip.isEmpty() && clip.isInverseFillType()) {
+    clipRect = rtRect;
+  } else if (!clip.isRect(&clipRect)) {
+    return Rect::MakeEmpty();
   }
-  auto deviceRect = viewMatrix.mapRect(localBounds);
-  if (!deviceRect.contains(rtRect)) {
-    return false;
+  if (!viewMatrix.rectStaysRect() || style.maskFilter) {
+    return Rect::MakeEmpty();
   }
-  if (style.maskFilter) {
-    return false;
+  // A color filter that may lower the alpha can leave the rect translucent.
+  if (style.colorFilter && !style.colorFilter->isAlphaUnchanged()) {
+    return Rect::MakeEmpty();
   }
-  if (style.colorFilter && style.colorFilter->isAlphaUnchanged()) {
-    return false;
+  auto deviceRect = viewMatrix.mapRect(localBounds);
+  if (!deviceRect.intersect(clipRect) || !deviceRect.intersect(rtRect)) {
+    return Rect::MakeEmpty();
+  }
+  // Only the pixels fully inside the rect are overwritten, the edge pixels may be antialiased.
+  deviceRect.setLTRB(ceilf(deviceRect.left), ceilf(deviceRect.top), floorf(deviceRect.right),
+                     floorf(deviceRect.bottom));
+  if (deviceRect.isEmpty()) {
+    return Rect::MakeEmpty();
   }
   auto opacityType = SrcColorOpacity::Unknown;
   auto alpha = style.color.alpha;
@@ -587,7 +1053,10 @@ bool RenderContext::wouldOverwriteEntireRT(const Rect& localBounds, const MCStat
       opacityType = SrcColorOpacity::TransparentBlack;
     }
   }
-  return BlendModeIsOpaque(style.blendMode, opacityType);
+  if (!BlendModeIsOpaque(style.blendMode, opacityType)) {
+    return Rect::MakeEmpty();
+  }
+  return deviceRect;
 }
 
 void RenderContext::replaceRenderTarget(std::shared_ptr<RenderTargetProxy> newRenderTargetProxy) {
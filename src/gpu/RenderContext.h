@@ -39,15 +39,28 @@ class RenderContext : public DrawContext {
 
   void drawRRect(const RRect& rRect, const MCState& state, const FillStyle& style) override;
 
+  void drawRects(const std::vector<Rect>& rects, const MCState& state,
+                 const FillStyle& style) override;
+
+  void drawRRects(const std::vector<RRect>& rRects, const MCState& state,
+                  const FillStyle& style) override;
+
   void drawPath(const Path& path, const MCState& state, const FillStyle& style,
                 const Stroke* stroke) override;
 
   void drawImageRect(std::shared_ptr<Image> image, const SamplingOptions& sampling,
                      const Rect& rect, const MCState& state, const FillStyle& style) override;
 
+  void drawImagePatches(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                        const std::vector<ImagePatch>& patches, const MCState& state,
+                        const FillStyle& style) override;
+
   void drawGlyphRun(GlyphRun glyphRun, const MCState& state, const FillStyle& style,
                     const Stroke* stroke) override;
 
+  void drawVertices(std::shared_ptr<Vertices> vertices, const MCState& state,
+                    const FillStyle& style) override;
+
   void drawLayer(std::shared_ptr<Picture> picture, const MCState& state, const FillStyle& style,
                  std::shared_ptr<ImageFilter> filter) override;
 
@@ -60,6 +73,7 @@ class RenderContext : public DrawContext {
 
   explicit RenderContext(Surface* surface);
   Context* getContext() const;
+  Rect getClipBounds(const Path& clip);
   std::shared_ptr<TextureProxy> getClipTexture(const Path& clip);
   std::pair<std::optional<Rect>, bool> getClipRect(const Path& clip,
                                                    const Rect* drawBounds = nullptr);
@@ -68,14 +82,22 @@ class RenderContext : public DrawContext {
   Rect clipLocalBounds(const Rect& localBounds, const MCState& state);
   std::unique_ptr<FragmentProcessor> makeTextureMask(const Path& path, const Matrix& viewMatrix,
                                                      const Stroke* stroke = nullptr);
+
+  bool drawAsTiledMask(const Path& path, const MCState& state, const FillStyle& style,
+                       const Stroke* stroke, const Rect& localBounds);
   bool drawAsClear(const Rect& rect, const MCState& state, const FillStyle& style);
   void drawColorGlyphs(const GlyphRun& glyphRun, const MCState& state, const FillStyle& style);
+  bool drawAsShadow(const Picture* picture, const MCState& state, const FillStyle& style,
+                    const ImageFilter* filter);
   void addDrawOp(std::unique_ptr<DrawOp> op, const Rect& localBounds, const MCState& state,
-                 const FillStyle& style);
-  void addOp(std::unique_ptr<Op> op, const std::function<bool()>& willDiscardContent);
+                 const FillStyle& style, bool isOpaqueFill = false);
+  void addOp(std::unique_ptr<Op> op, const Rect& deviceBounds,
+             const std::function<bool()>& willDiscardContent);
   void replaceRenderTarget(std::shared_ptr<RenderTargetProxy> newRenderTargetProxy);
+  Rect getOpaqueBounds(const Rect& localBounds, const MCState& state,
+                       const FillStyle& style) const;
   bool wouldOverwriteEntireRT(const Rect& localBounds, const MCState& state, const FillStyle& style,
-                              bool isRectOp) const;
+                              bool isOpaqueFill) const;
 
   friend class Surface;
 };
@@ -33,6 +33,7 @@ bool RenderPass::begin(std::shared_ptr<RenderTargetProxy> renderTargetProxy) {
 }
 
 void RenderPass::end() {
+  onEnd();
   _renderTarget = nullptr;
   _renderTargetTexture = nullptr;
   resetActiveBuffers();
@@ -162,7 +162,19 @@ std::shared_ptr<Resource> ResourceCache::refResource(Resource* resource) {
   return resource->reference;
 }
 
-void ResourceCache::removeResource(Resource* resource) {
+void ResourceCache::detachResource(Resource* resource) {
+  if (InList(nonpurgeableResources, resource)) {
+    RemoveFromList(nonpurgeableResources, resource);
+  } else if (InList(purgeableResources, resource)) {
+    RemoveFromList(purgeableResources, resource);
+    purgeableBytes -= resource->memoryUsage();
+  } else {
+    return;
+  }
+  removeResource(resource, false);
+}
+
+void ResourceCache::removeResource(Resource* resource, bool releaseGPU) {
   if (!resource->uniqueKey.empty()) {
     removeUniqueKey(resource);
   }
@@ -177,7 +189,7 @@ void ResourceCache::removeResource(Resource* resource) {
     }
   }
   totalBytes -= resource->memoryUsage();
-  resource->release(true);
+  resource->release(releaseGPU);
 }
 
 void ResourceCache::purgeNotUsedSince(std::chrono::steady_clock::time_point purgeTime,
@@ -105,6 +105,12 @@ class ResourceCache {
    */
   bool purgeToCacheLimit(std::chrono::steady_clock::time_point notUsedSinceTime);
 
+  /**
+   * Removes the resource from the cache without freeing its GPU objects. The caller takes over the
+   * responsibility of freeing them in the backend API.
+   */
+  void detachResource(Resource* resource);
+
  private:
   Context* context = nullptr;
   size_t maxBytes = 0;
@@ -123,7 +129,7 @@ class ResourceCache {
   void processUnreferencedResources();
   std::shared_ptr<Resource> addResource(Resource* resource, const ScratchKey& scratchKey);
   std::shared_ptr<Resource> refResource(Resource* resource);
-  void removeResource(Resource* resource);
+  void removeResource(Resource* resource, bool releaseGPU = true);
   void purgeResourcesByLRU(bool scratchResourceOnly,
                            const std::function<bool(Resource*)>& satisfied);
 
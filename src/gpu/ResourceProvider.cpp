@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ResourceProvider.h"
+#include "ColorGlyphCache.h"
 #include "GradientCache.h"
 #include "tgfx/utils/Buffer.h"
 #include "utils/Log.h"
@@ -37,7 +38,7 @@ class PatternedIndexBufferProvider : public DataProvider {
     }
     auto* data = reinterpret_cast<uint16_t*>(buffer.data());
     for (uint16_t i = 0; i < reps; ++i) {
-      uint16_t baseIdx = i * patternSize;
+      auto baseIdx = static_cast<size_t>(i) * patternSize;
       auto baseVert = static_cast<uint16_t>(i * vertCount);
       for (uint16_t j = 0; j < patternSize; ++j) {
         data[baseIdx + j] = baseVert + pattern[j];
@@ -57,9 +58,13 @@ ResourceProvider::~ResourceProvider() {
   if (_gradientCache) {
     DEBUG_ASSERT(_gradientCache->empty());
   }
+  if (_colorGlyphCache) {
+    DEBUG_ASSERT(_colorGlyphCache->empty());
+  }
   DEBUG_ASSERT(_aaQuadIndexBuffer == nullptr);
   DEBUG_ASSERT(_nonAAQuadIndexBuffer == nullptr);
   delete _gradientCache;
+  delete _colorGlyphCache;
 }
 
 std::shared_ptr<Texture> ResourceProvider::getGradient(const Color* colors, const float* positions,
@@ -70,6 +75,13 @@ std::shared_ptr<Texture> ResourceProvider::getGradient(const Color* colors, cons
   return _gradientCache->getGradient(context, colors, positions, count);
 }
 
+ColorGlyphCache* ResourceProvider::colorGlyphCache() {
+  if (_colorGlyphCache == nullptr) {
+    _colorGlyphCache = new ColorGlyphCache(context);
+  }
+  return _colorGlyphCache;
+}
+
 std::shared_ptr<GpuBufferProxy> ResourceProvider::nonAAQuadIndexBuffer() {
   if (_nonAAQuadIndexBuffer == nullptr) {
     _nonAAQuadIndexBuffer = createNonAAQuadIndexBuffer();
@@ -87,13 +99,13 @@ std::shared_ptr<GpuBufferProxy> ResourceProvider::aaQuadIndexBuffer() {
 static constexpr uint16_t kMaxNumNonAAQuads = 1 << 8;  // max possible: (1 << 14) - 1;
 static constexpr uint16_t kVerticesPerNonAAQuad = 4;
 static constexpr uint16_t kIndicesPerNonAAQuad = 6;
+// clang-format off
+static constexpr uint16_t kNonAAQuadIndexPattern[] = {
+  0, 1, 2, 2, 1, 3
+};
+// clang-format on
 
 std::shared_ptr<GpuBufferProxy> ResourceProvider::createNonAAQuadIndexBuffer() {
-  // clang-format off
-  static constexpr uint16_t kNonAAQuadIndexPattern[] = {
-    0, 1, 2, 2, 1, 3
-  };
-  // clang-format on
   auto provider = std::make_shared<PatternedIndexBufferProvider>(
       kNonAAQuadIndexPattern, kIndicesPerNonAAQuad, kMaxNumNonAAQuads, kVerticesPerNonAAQuad);
   return GpuBufferProxy::MakeFrom(context, std::move(provider), BufferType::Index);
@@ -110,17 +122,17 @@ uint16_t ResourceProvider::NumIndicesPerNonAAQuad() {
 static constexpr uint16_t kMaxNumAAQuads = 1 << 6;  // max possible: (1 << 13) - 1;
 static constexpr uint16_t kVerticesPerAAQuad = 8;
 static constexpr uint16_t kIndicesPerAAQuad = 30;
+// clang-format off
+static constexpr uint16_t kAAQuadIndexPattern[] = {
+  0, 1, 2, 1, 3, 2,
+  0, 4, 1, 4, 5, 1,
+  0, 6, 4, 0, 2, 6,
+  2, 3, 6, 3, 7, 6,
+  1, 5, 3, 3, 5, 7,
+};
+// clang-format on
 
 std::shared_ptr<GpuBufferProxy> ResourceProvider::createAAQuadIndexBuffer() {
-  // clang-format off
-  static constexpr uint16_t kAAQuadIndexPattern[] = {
-    0, 1, 2, 1, 3, 2,
-    0, 4, 1, 4, 5, 1,
-    0, 6, 4, 0, 2, 6,
-    2, 3, 6, 3, 7, 6,
-    1, 5, 3, 3, 5, 7,
-  };
-  // clang-format on
   auto provider = std::make_shared<PatternedIndexBufferProvider>(
       kAAQuadIndexPattern, kIndicesPerAAQuad, kMaxNumAAQuads, kVerticesPerAAQuad);
   return GpuBufferProxy::MakeFrom(context, std::move(provider), BufferType::Index);
@@ -134,10 +146,44 @@ uint16_t ResourceProvider::NumIndicesPerAAQuad() {
   return kIndicesPerAAQuad;
 }
 
+// The largest quad count whose vertices can all be addressed by 16-bit indices, for both AA and
+// non-AA quads.
+static constexpr uint16_t kMaxNumQuadsPerDraw = (1 << 13) - 1;
+
+std::shared_ptr<GpuBufferProxy> ResourceProvider::quadIndexBuffer(bool antiAlias,
+                                                                  size_t quadCount) {
+  if (antiAlias && quadCount <= kMaxNumAAQuads) {
+    return aaQuadIndexBuffer();
+  }
+  if (!antiAlias && quadCount <= kMaxNumNonAAQuads) {
+    return nonAAQuadIndexBuffer();
+  }
+  if (quadCount > kMaxNumQuadsPerDraw) {
+    return nullptr;
+  }
+  auto reps = static_cast<uint16_t>(quadCount);
+  std::shared_ptr<DataProvider> provider = nullptr;
+  if (antiAlias) {
+    provider = std::make_shared<PatternedIndexBufferProvider>(
+        kAAQuadIndexPattern, kIndicesPerAAQuad, reps, kVerticesPerAAQuad);
+  } else {
+    provider = std::make_shared<PatternedIndexBufferProvider>(
+        kNonAAQuadIndexPattern, kIndicesPerNonAAQuad, reps, kVerticesPerNonAAQuad);
+  }
+  return GpuBufferProxy::MakeFrom(context, std::move(provider), BufferType::Index);
+}
+
+uint16_t ResourceProvider::MaxNumQuadsPerDraw() {
+  return kMaxNumQuadsPerDraw;
+}
+
 void ResourceProvider::releaseAll() {
   if (_gradientCache) {
     _gradientCache->releaseAll();
   }
+  if (_colorGlyphCache) {
+    _colorGlyphCache->releaseAll();
+  }
   _aaQuadIndexBuffer = nullptr;
   _nonAAQuadIndexBuffer = nullptr;
 }
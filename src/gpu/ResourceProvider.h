@@ -24,6 +24,7 @@
 
 namespace tgfx {
 class GradientCache;
+class ColorGlyphCache;
 
 class ResourceProvider {
  public:
@@ -34,6 +35,8 @@ class ResourceProvider {
 
   std::shared_ptr<Texture> getGradient(const Color* colors, const float* positions, int count);
 
+  ColorGlyphCache* colorGlyphCache();
+
   std::shared_ptr<GpuBufferProxy> nonAAQuadIndexBuffer();
 
   static uint16_t MaxNumNonAAQuads();
@@ -46,6 +49,18 @@ class ResourceProvider {
 
   static uint16_t NumIndicesPerAAQuad();
 
+  /**
+   * Returns an index buffer for drawing the specified number of quads. The shared quad index
+   * buffer is returned if it is large enough, otherwise a dedicated one is created. Returns nullptr
+   * if quadCount exceeds MaxNumQuadsPerDraw().
+   */
+  std::shared_ptr<GpuBufferProxy> quadIndexBuffer(bool antiAlias, size_t quadCount);
+
+  /**
+   * Returns the maximum number of quads that can be drawn with a single index buffer.
+   */
+  static uint16_t MaxNumQuadsPerDraw();
+
   void releaseAll();
 
  private:
@@ -55,6 +70,7 @@ class ResourceProvider {
 
   Context* context = nullptr;
   GradientCache* _gradientCache = nullptr;
+  ColorGlyphCache* _colorGlyphCache = nullptr;
   std::shared_ptr<GpuBufferProxy> _aaQuadIndexBuffer;
   std::shared_ptr<GpuBufferProxy> _nonAAQuadIndexBuffer;
 };
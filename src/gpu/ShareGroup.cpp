@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ShareGroup.h"
+#include "gpu/Gpu.h"
+#include "gpu/ResourceCache.h"
+#include "utils/UniqueID.h"
+
+namespace tgfx {
+std::shared_ptr<ShareGroup> ShareGroup::Make() {
+  return std::shared_ptr<ShareGroup>(new ShareGroup());
+}
+
+void ShareGroup::addContext() {
+  contextCount.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void ShareGroup::removeContext() {
+  contextCount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+std::shared_ptr<Texture> ShareGroup::findTexture(Context* context, const UniqueKey& uniqueKey) {
+  if (uniqueKey.empty() || !isShared()) {
+    return nullptr;
+  }
+  std::shared_ptr<SharedTexture> texture = nullptr;
+  {
+    // The wrapper must be created while locked, so that the record can't be freed by the last
+    // SharedTexture of another Context in the meantime.
+    std::lock_guard<std::mutex> autoLock(locker);
+    auto result = records.find(uniqueKey);
+    if (result == records.end()) {
+      return nullptr;
+    }
+    auto record = result->second.lock();
+    if (record == nullptr) {
+      records.erase(result);
+      return nullptr;
+    }
+    texture = SharedTexture::MakeFrom(context, std::move(record));
+  }
+  if (texture == nullptr) {
+    return nullptr;
+  }
+  auto& record = texture->record;
+  if (record->deviceID != context->device()->uniqueID()) {
+    context->gpu()->waitSemaphore(record->fence.get());
+  }
+  texture->assignUniqueKey(uniqueKey);
+  return texture;
+}
+
+std::shared_ptr<Texture> ShareGroup::shareTexture(Context* context, const UniqueKey& uniqueKey,
+                                                  std::shared_ptr<Texture> texture) {
+  if (uniqueKey.empty() || texture == nullptr || !isShared() || texture->isYUV() ||
+      texture->getSampler()->type() != TextureType::TwoD || !context->caps()->semaphoreSupport) {
+    return texture;
+  }
+  auto backendTexture = texture->getBackendTexture();
+  if (!backendTexture.isValid()) {
+    return texture;
+  }
+  std::lock_guard<std::mutex> autoLock(locker);
+  auto result = records.find(uniqueKey);
+  if (result != records.end() && !result->second.expired()) {
+    // Another Context uploaded the same image concurrently, keep the private copy.
+    return texture;
+  }
+  BackendSemaphore backendSemaphore = {};
+  auto fence = Semaphore::Wrap(&backendSemaphore);
+  if (fence == nullptr || !context->gpu()->insertSemaphore(fence.get())) {
+    return texture;
+  }
+  auto record = std::make_shared<SharedTextureRecord>();
+  record->backendTexture = backendTexture;
+  record->uniqueKey = uniqueKey;
+  record->fence = std::move(fence);
+  record->deviceID = context->device()->uniqueID();
+  record->uniqueID = UniqueID::Next();
+  record->memoryUsage = texture->memoryUsage();
+  record->texture = texture;
+  auto sharedTexture = SharedTexture::MakeFrom(context, record);
+  if (sharedTexture == nullptr) {
+    context->gpu()->deleteSemaphore(record->fence.get());
+    return texture;
+  }
+  // From now on, the backend texture is owned by the SharedTextures of all Contexts.
+  context->resourceCache()->detachResource(texture.get());
+  records[uniqueKey] = record;
+  return sharedTexture;
+}
+
+void ShareGroup::releaseTexture(Context* context, SharedTexture* texture) {
+  std::lock_guard<std::mutex> autoLock(locker);
+  auto record = std::move(texture->record);
+  if (record.use_count() > 1) {
+    return;
+  }
+  // The last SharedTexture is released while its Context is current, so the backend objects can
+  // be freed from here even if the Context that uploaded them is already gone.
+  auto gpu = context->gpu();
+  gpu->deleteSampler(texture->sampler.get());
+  gpu->deleteSemaphore(record->fence.get());
+  auto result = records.find(record->uniqueKey);
+  if (result != records.end() && result->second.lock() == record) {
+    records.erase(result);
+  }
+}
+}  // namespace tgfx
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include "gpu/ResourceKey.h"
+#include "gpu/SharedTexture.h"
+
+namespace tgfx {
+/**
+ * ShareGroup tracks the textures that can be used by every Context whose backend contexts share
+ * GPU objects, e.g. the EGL contexts created by GLDevice::Make() with a shared context. A texture
+ * uploaded by one Context is published under the UniqueKey of its image, so that other Contexts
+ * sample the same backend texture instead of decoding and uploading the image again. Consumers
+ * wait on a fence inserted after the upload before using the texture. All methods are thread-safe.
+ */
+class ShareGroup {
+ public:
+  static std::shared_ptr<ShareGroup> Make();
+
+  /**
+   * Returns true if more than one Context belongs to the ShareGroup. Textures are only published
+   * while this is true, so a single Context doesn't pay for fences it never needs.
+   */
+  bool isShared() const {
+    return contextCount.load(std::memory_order_acquire) > 1;
+  }
+
+  void addContext();
+
+  void removeContext();
+
+  /**
+   * Returns a texture in the specified Context for the texture published under the UniqueKey,
+   * which has the UniqueKey assigned. Returns nullptr if there is no such texture.
+   */
+  std::shared_ptr<Texture> findTexture(Context* context, const UniqueKey& uniqueKey);
+
+  /**
+   * Publishes the texture just uploaded by the specified Context under the UniqueKey, and returns
+   * the SharedTexture that replaces it in the Context. Returns the texture itself if it can not be
+   * shared, e.g. if it has multiple planes or is bound to a platform-specific buffer.
+   */
+  std::shared_ptr<Texture> shareTexture(Context* context, const UniqueKey& uniqueKey,
+                                        std::shared_ptr<Texture> texture);
+
+ private:
+  std::mutex locker = {};
+  std::atomic_int contextCount = 0;
+  UniqueKeyMap<std::weak_ptr<SharedTextureRecord>> records = {};
+
+  ShareGroup() = default;
+
+  void releaseTexture(Context* context, SharedTexture* texture);
+
+  friend class SharedTexture;
+};
+}  // namespace tgfx
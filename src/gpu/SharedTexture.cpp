@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SharedTexture.h"
+#include "gpu/ShareGroup.h"
+#include "utils/UniqueID.h"
+
+namespace tgfx {
+static ScratchKey ComputeScratchKey(uint32_t recordID) {
+  // The key never matches any other texture. It only keeps the wrapper in the cache after all of
+  // its proxies are released, just like the scratch key of a PlainTexture.
+  static const uint32_t SharedTextureType = UniqueID::Next();
+  BytesKey bytesKey(2);
+  bytesKey.write(SharedTextureType);
+  bytesKey.write(recordID);
+  return bytesKey;
+}
+
+std::shared_ptr<SharedTexture> SharedTexture::MakeFrom(
+    Context* context, std::shared_ptr<SharedTextureRecord> record) {
+  if (context == nullptr || record == nullptr) {
+    return nullptr;
+  }
+  auto sampler = TextureSampler::MakeFrom(context, record->backendTexture);
+  if (sampler == nullptr) {
+    return nullptr;
+  }
+  sampler->maxMipmapLevel = record->texture->getSampler()->maxMipmapLevel;
+  auto scratchKey = ComputeScratchKey(record->uniqueID);
+  auto texture = new SharedTexture(std::move(sampler), std::move(record));
+  return Resource::AddToCache(context, texture, scratchKey);
+}
+
+SharedTexture::SharedTexture(std::unique_ptr<TextureSampler> sampler,
+                             std::shared_ptr<SharedTextureRecord> record)
+    : Texture(record->texture->width(), record->texture->height(), record->texture->origin()),
+      sampler(std::move(sampler)), record(std::move(record)),
+      _memoryUsage(this->record->memoryUsage) {
+}
+
+void SharedTexture::onReleaseGPU() {
+  context->shareGroup()->releaseTexture(context, this);
+}
+}  // namespace tgfx
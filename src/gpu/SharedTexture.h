@@ -0,0 +1,76 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "gpu/Semaphore.h"
+#include "gpu/Texture.h"
+
+namespace tgfx {
+/**
+ * SharedTextureRecord holds a texture uploaded by one Context that every Context in the same
+ * ShareGroup can sample from.
+ */
+struct SharedTextureRecord {
+  /**
+   * The texture detached from the cache of the Context that uploaded it. It keeps any CPU-side
+   * objects of the texture alive, while its backend texture is freed by the ShareGroup.
+   */
+  std::shared_ptr<Texture> texture = nullptr;
+  BackendTexture backendTexture = {};
+  /**
+   * Signaled by the GPU once the upload commands have been executed.
+   */
+  std::unique_ptr<Semaphore> fence = nullptr;
+  UniqueKey uniqueKey = {};
+  uint32_t deviceID = 0;
+  uint32_t uniqueID = 0;
+  size_t memoryUsage = 0;
+};
+
+/**
+ * SharedTexture wraps a SharedTextureRecord in a single Context. The backend texture is freed when
+ * the last SharedTexture referencing the record is released.
+ */
+class SharedTexture : public Texture {
+ public:
+  static std::shared_ptr<SharedTexture> MakeFrom(Context* context,
+                                                 std::shared_ptr<SharedTextureRecord> record);
+
+  size_t memoryUsage() const override {
+    return _memoryUsage;
+  }
+
+  const TextureSampler* getSampler() const override {
+    return sampler.get();
+  }
+
+ protected:
+  void onReleaseGPU() override;
+
+ private:
+  std::unique_ptr<TextureSampler> sampler = {};
+  std::shared_ptr<SharedTextureRecord> record = nullptr;
+  size_t _memoryUsage = 0;
+
+  SharedTexture(std::unique_ptr<TextureSampler> sampler,
+                std::shared_ptr<SharedTextureRecord> record);
+
+  friend class ShareGroup;
+};
+}  // namespace tgfx
@@ -20,6 +20,7 @@
 #include "DrawingManager.h"
 #include "gpu/RenderContext.h"
 #include "images/TextureImage.h"
+#include "tgfx/utils/Buffer.h"
 #include "utils/Log.h"
 #include "utils/PixelFormatUtil.h"
 
@@ -102,6 +103,7 @@ ImageOrigin Surface::origin() const {
 }
 
 BackendRenderTarget Surface::getBackendRenderTarget() {
+  resolvePendingContent();
   flush();
   auto renderTarget = renderTargetProxy->getRenderTarget();
   if (renderTarget == nullptr) {
@@ -114,6 +116,7 @@ BackendTexture Surface::getBackendTexture() {
   if (!renderTargetProxy->isTextureBacked()) {
     return {};
   }
+  resolvePendingContent();
   flush();
   auto texture = renderTargetProxy->getTexture();
   if (texture == nullptr) {
@@ -126,6 +129,7 @@ HardwareBufferRef Surface::getHardwareBuffer() {
   if (!renderTargetProxy->isTextureBacked()) {
     return nullptr;
   }
+  resolvePendingContent();
   flushAndSubmit(true);
   auto texture = renderTargetProxy->getTexture();
   if (texture == nullptr) {
@@ -167,6 +171,7 @@ std::shared_ptr<Image> Surface::makeImageSnapshot() {
   if (cachedImage != nullptr) {
     return cachedImage;
   }
+  resolvePendingContent();
   auto drawingManager = getContext()->drawingManager();
   drawingManager->addTextureResolveTask(renderTargetProxy);
   auto textureProxy = renderTargetProxy->getTextureProxy();
@@ -190,10 +195,88 @@ Color Surface::getColor(int x, int y) {
   return Color::FromRGBA(color[0], color[1], color[2], color[3]);
 }
 
+std::vector<Color> Surface::getColors(const std::vector<Point>& points) {
+  std::vector<Color> colors(points.size(), Color::Transparent());
+  auto surfaceBounds = Rect::MakeWH(width(), height());
+  std::vector<size_t> indices = {};
+  std::vector<Point> pixels = {};
+  auto readBounds = Rect::MakeEmpty();
+  for (size_t i = 0; i < points.size(); i++) {
+    auto pixel = Point::Make(floorf(points[i].x), floorf(points[i].y));
+    if (!surfaceBounds.contains(pixel.x, pixel.y)) {
+      continue;
+    }
+    indices.push_back(i);
+    pixels.push_back(pixel);
+    readBounds.join(Rect::MakeXYWH(pixel.x, pixel.y, 1.0f, 1.0f));
+  }
+  if (pixels.empty()) {
+    return colors;
+  }
+  auto count = static_cast<int>(pixels.size());
+  auto readWidth = static_cast<int>(readBounds.width());
+  auto readHeight = static_cast<int>(readBounds.height());
+  auto info =
+      ImageInfo::Make(readWidth, readHeight, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  Buffer buffer = {};
+  // Reading the bounding box of nearby points is cheaper than gathering them one by one.
+  static constexpr int MaxPixelsPerProbe = 16;
+  if (readWidth * readHeight <= std::max(count * MaxPixelsPerProbe, 1024)) {
+    buffer.alloc(info.byteSize());
+    if (!readPixels(info, buffer.data(), static_cast<int>(readBounds.left),
+                    static_cast<int>(readBounds.top))) {
+      return colors;
+    }
+  } else {
+    // Gather the probed pixels into a single row with GPU copies, and read them back at once.
+    // Pixels that are still pending are gathered from the old render target directly.
+    restoreCopySource();
+    auto probeProxy = RenderTargetProxy::Make(getContext(), count, 1, renderTargetProxy->format());
+    auto probeTexture = probeProxy ? probeProxy->getTextureProxy() : nullptr;
+    if (probeTexture == nullptr) {
+      return colors;
+    }
+    auto drawingManager = getContext()->drawingManager();
+    auto flipY = renderTargetProxy->origin() == ImageOrigin::BottomLeft;
+    for (int i = 0; i < count; i++) {
+      auto pixel = pixels[static_cast<size_t>(i)];
+      if (flipY) {
+        pixel.y = static_cast<float>(height()) - pixel.y - 1;
+      }
+      auto pixelRect = Rect::MakeXYWH(pixel.x, pixel.y, 1.0f, 1.0f);
+      auto source = isPendingPixel(pixels[static_cast<size_t>(i)]) ? copySource : renderTargetProxy;
+      drawingManager->addRenderTargetCopyTask(source, probeTexture, pixelRect,
+                                              Point::Make(static_cast<float>(i), 0.0f));
+    }
+    getContext()->flush();
+    auto renderTarget = probeProxy->getRenderTarget();
+    info = ImageInfo::Make(count, 1, ColorType::RGBA_8888, AlphaType::Premultiplied);
+    buffer.alloc(info.byteSize());
+    if (renderTarget == nullptr || !renderTarget->readPixels(info, buffer.data())) {
+      return colors;
+    }
+    for (int i = 0; i < count; i++) {
+      pixels[static_cast<size_t>(i)] = Point::Make(static_cast<float>(i), 0.0f);
+    }
+    readBounds = Rect::MakeWH(count, 1);
+  }
+  auto data = buffer.bytes();
+  for (size_t i = 0; i < pixels.size(); i++) {
+    auto x = static_cast<size_t>(pixels[i].x - readBounds.left);
+    auto y = static_cast<size_t>(pixels[i].y - readBounds.top);
+    auto color = data + y * info.rowBytes() + x * 4;
+    colors[indices[i]] = Color::FromRGBA(color[0], color[1], color[2], color[3]);
+  }
+  return colors;
+}
+
 bool Surface::readPixels(const ImageInfo& dstInfo, void* dstPixels, int srcX, int srcY) {
   if (dstInfo.isEmpty() || dstPixels == nullptr) {
     return false;
   }
+  if (!restoreCopySource()) {
+    copyPendingContent(Rect::MakeXYWH(srcX, srcY, dstInfo.width(), dstInfo.height()));
+  }
   flush();
   auto texture = renderTargetProxy->getTexture();
   auto hardwareBuffer = texture ? texture->getHardwareBuffer() : nullptr;
@@ -214,12 +297,26 @@ bool Surface::readPixels(const ImageInfo& dstInfo, void* dstPixels, int srcX, in
   return renderTarget->readPixels(dstInfo, dstPixels, srcX, srcY);
 }
 
-bool Surface::aboutToDraw(const std::function<bool()>& willDiscardContent) {
-  if (cachedImage == nullptr) {
-    return true;
+bool Surface::aboutToDraw(const Rect& deviceBounds,
+                          const std::function<bool()>& willDiscardContent) {
+  if (cachedImage != nullptr && !detachFromSnapshot(willDiscardContent)) {
+    return false;
+  }
+  if (copySource != nullptr && !restoreCopySource()) {
+    if (willDiscardContent()) {
+      copySource = nullptr;
+      copySourceImage.reset();
+      copiedRects.clear();
+    } else {
+      copyPendingContent(deviceBounds);
+    }
   }
+  return true;
+}
+
+bool Surface::detachFromSnapshot(const std::function<bool()>& willDiscardContent) {
   auto isUnique = cachedImage.use_count() == 1;
-  cachedImage = nullptr;
+  auto snapshot = std::move(cachedImage);
   if (isUnique) {
     return true;
   }
@@ -233,13 +330,131 @@ bool Surface::aboutToDraw(const std::function<bool()>& willDiscardContent) {
     return false;
   }
   if (!willDiscardContent()) {
-    auto newTextureProxy = newRenderTargetProxy->getTextureProxy();
-    auto drawingManager = getContext()->drawingManager();
-    drawingManager->addRenderTargetCopyTask(renderTargetProxy, newTextureProxy,
-                                            Rect::MakeWH(width(), height()), Point::Zero());
+    // The old content is not copied right away. The snapshot keeps the old render target alive, so
+    // we only copy the regions touched by subsequent draws, and the rest on demand.
+    copySource = renderTargetProxy;
+    copySourceImage = snapshot;
+    copiedRects.clear();
   }
   renderTargetProxy = std::move(newRenderTargetProxy);
   renderContext->replaceRenderTarget(renderTargetProxy);
   return true;
 }
+
+/**
+ * Appends the parts of rect that are not covered by any of the given rects to result.
+ */
+static void SubtractRects(const Rect& rect, const std::vector<Rect>& rects, size_t index,
+                          std::vector<Rect>* result) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  if (index == rects.size()) {
+    result->push_back(rect);
+    return;
+  }
+  auto& cut = rects[index];
+  auto overlap = rect;
+  if (!overlap.intersect(cut)) {
+    SubtractRects(rect, rects, index + 1, result);
+    return;
+  }
+  SubtractRects(Rect::MakeLTRB(rect.left, rect.top, rect.right, overlap.top), rects, index + 1,
+                result);
+  SubtractRects(Rect::MakeLTRB(rect.left, overlap.bottom, rect.right, rect.bottom), rects,
+                index + 1, result);
+  SubtractRects(Rect::MakeLTRB(rect.left, overlap.top, overlap.left, overlap.bottom), rects,
+                index + 1, result);
+  SubtractRects(Rect::MakeLTRB(overlap.right, overlap.top, rect.right, overlap.bottom), rects,
+                index + 1, result);
+}
+
+/**
+ * The maximum number of separate copied areas tracked for a pending copy source. A few areas cover
+ * scattered small strokes, beyond that they are merged into their bounding box.
+ */
+static constexpr size_t MaxCopiedRects = 8;
+
+void Surface::copyPendingContent(const Rect& deviceBounds) {
+  if (copySource == nullptr) {
+    return;
+  }
+  auto surfaceBounds = Rect::MakeWH(width(), height());
+  auto bounds = deviceBounds;
+  bounds.roundOut();
+  if (!bounds.intersect(surfaceBounds)) {
+    return;
+  }
+  std::vector<Rect> copyRects = {};
+  SubtractRects(bounds, copiedRects, 0, &copyRects);
+  if (copyRects.empty()) {
+    return;
+  }
+  if (copiedRects.size() < MaxCopiedRects) {
+    copiedRects.push_back(bounds);
+  } else {
+    for (auto& rect : copiedRects) {
+      bounds.join(rect);
+    }
+    copyRects.clear();
+    SubtractRects(bounds, copiedRects, 0, &copyRects);
+    copiedRects = {bounds};
+  }
+  copyRenderTarget(copySource, renderTargetProxy->getTextureProxy(), copyRects);
+  if (copiedRects.size() == 1 && copiedRects[0] == surfaceBounds) {
+    copySource = nullptr;
+    copySourceImage.reset();
+    copiedRects.clear();
+  }
+}
+
+bool Surface::isPendingPixel(const Point& pixel) const {
+  if (copySource == nullptr) {
+    return false;
+  }
+  for (auto& rect : copiedRects) {
+    if (rect.contains(pixel.x, pixel.y)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Surface::resolvePendingContent() {
+  if (!restoreCopySource()) {
+    copyPendingContent(Rect::MakeWH(width(), height()));
+  }
+}
+
+bool Surface::restoreCopySource() {
+  if (copySource == nullptr) {
+    return true;
+  }
+  if (!copySourceImage.expired()) {
+    return false;
+  }
+  // Nothing reads the old render target anymore, so the areas drawn since the switch are copied
+  // back into it, which is usually much less than the rest of the surface.
+  copyRenderTarget(renderTargetProxy, copySource->getTextureProxy(), copiedRects);
+  renderTargetProxy = std::move(copySource);
+  renderContext->replaceRenderTarget(renderTargetProxy);
+  copiedRects.clear();
+  return true;
+}
+
+void Surface::copyRenderTarget(std::shared_ptr<RenderTargetProxy> source,
+                               std::shared_ptr<TextureProxy> dest, const std::vector<Rect>& rects) {
+  auto drawingManager = getContext()->drawingManager();
+  auto flipY = source->origin() == ImageOrigin::BottomLeft;
+  for (auto rect : rects) {
+    if (rect.isEmpty()) {
+      continue;
+    }
+    if (flipY) {
+      rect = Rect::MakeXYWH(rect.left, static_cast<float>(height()) - rect.bottom, rect.width(),
+                            rect.height());
+    }
+    drawingManager->addRenderTargetCopyTask(source, dest, rect, Point::Make(rect.left, rect.top));
+  }
+}
 }  // namespace tgfx
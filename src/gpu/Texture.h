@@ -180,6 +180,21 @@ class Texture : public Resource {
    */
   bool hasMipmaps() const;
 
+  /**
+   * Returns true if the base level of the texture has been rendered to since its mipmap levels
+   * were last regenerated.
+   */
+  bool mipmapsDirty() const {
+    return _mipmapsDirty;
+  }
+
+  /**
+   * Marks whether the mipmap levels of the texture are out of date with its base level.
+   */
+  void setMipmapsDirty(bool dirty) {
+    _mipmapsDirty = dirty;
+  }
+
   /**
    * Returns true if this is a YUVTexture.
    */
@@ -217,5 +232,6 @@ class Texture : public Resource {
   int _width = 0;
   int _height = 0;
   ImageOrigin _origin = ImageOrigin::TopLeft;
+  bool _mipmapsDirty = true;
 };
 }  // namespace tgfx
@@ -76,6 +76,14 @@ class UniformBuffer {
     onSetData(name, &value, sizeof(value));
   }
 
+  /**
+   * Copies count floats into the uniform buffer. The count must match the size of the uniform
+   * specified by name.
+   */
+  void setData(const std::string& name, const float* values, size_t count) {
+    onSetData(name, values, count * sizeof(float));
+  }
+
   /**
    * Convenience method for copying a Matrix to a 3x3 matrix in column-major order.
    */
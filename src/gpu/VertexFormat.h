@@ -0,0 +1,57 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include "tgfx/core/Color.h"
+
+namespace tgfx {
+/**
+ * Describes how a vertex attribute is stored in the vertex buffer. The storage may be more compact
+ * than the shader type the attribute is read as.
+ */
+enum class VertexFormat {
+  Float,
+  Float2,
+  Float3,
+  Float4,
+  Int,
+  Int2,
+  Int3,
+  Int4,
+  /**
+   * Four unsigned bytes, each normalized to [0, 1] when read by the shader as a Float4.
+   */
+  UByte4Normalized
+};
+
+/**
+ * Writes the color into the next four-byte slot of the vertices as VertexFormat::UByte4Normalized.
+ */
+inline void WriteUByte4Color(float* vertices, int& index, const Color& color) {
+  auto toByte = [](float value) {
+    return static_cast<uint8_t>(std::max(0.0f, std::min(value, 1.0f)) * 255.0f + 0.5f);
+  };
+  uint8_t bytes[4] = {toByte(color.red), toByte(color.green), toByte(color.blue),
+                      toByte(color.alpha)};
+  memcpy(vertices + index, bytes, sizeof(bytes));
+  index++;
+}
+}  // namespace tgfx
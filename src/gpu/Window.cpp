@@ -29,11 +29,21 @@ std::shared_ptr<Device> Window::getDevice() {
   return device;
 }
 
+/**
+ * The maximum number of frames whose damage is remembered. Back buffers older than this are fully
+ * repainted.
+ */
+static constexpr size_t MaxDamageHistory = 4;
+
 std::shared_ptr<tgfx::Surface> Window::getSurface(Context* context, bool queryOnly) {
   std::lock_guard<std::mutex> autoLock(locker);
   if (!checkContext(context)) {
     return nullptr;
   }
+  return getOrCreateSurface(context, queryOnly);
+}
+
+std::shared_ptr<Surface> Window::getOrCreateSurface(Context* context, bool queryOnly) {
   if (surface != nullptr && !sizeInvalid) {
     return surface;
   }
@@ -42,6 +52,8 @@ std::shared_ptr<tgfx::Surface> Window::getSurface(Context* context, bool queryOn
   }
   surface = onCreateSurface(context);
   sizeInvalid = false;
+  damageHistory.clear();
+  hasDirtyRect = false;
   return surface;
 }
 
@@ -53,6 +65,47 @@ void Window::invalidSize() {
 void Window::freeSurface() {
   std::lock_guard<std::mutex> autoLock(locker);
   onFreeSurface();
+  damageHistory.clear();
+  hasDirtyRect = false;
+}
+
+Rect Window::setDirtyRect(Context* context, const Rect& dirtyRect) {
+  std::lock_guard<std::mutex> autoLock(locker);
+  if (!checkContext(context)) {
+    return Rect::MakeEmpty();
+  }
+  auto currentSurface = getOrCreateSurface(context, false);
+  if (currentSurface == nullptr) {
+    return Rect::MakeEmpty();
+  }
+  auto bounds = Rect::MakeWH(currentSurface->width(), currentSurface->height());
+  auto repaintRect = dirtyRect;
+  repaintRect.roundOut();
+  if (!repaintRect.intersect(bounds)) {
+    repaintRect.setEmpty();
+  }
+  auto age = static_cast<size_t>(std::max(onQueryBufferAge(), 0));
+  if (age == 0 || age > damageHistory.size() + 1) {
+    repaintRect = bounds;
+  } else {
+    // The back buffer misses the changes of the frames presented after it.
+    for (size_t i = 1; i < age; i++) {
+      repaintRect.join(damageHistory[damageHistory.size() - i]);
+    }
+  }
+  onSetDamageRegion(repaintRect);
+  auto canvas = currentSurface->getCanvas();
+  if (hasDirtyRect) {
+    canvas->restoreToCount(dirtySaveCount);
+  }
+  dirtySaveCount = canvas->getSaveCount();
+  hasDirtyRect = true;
+  canvas->save();
+  auto matrix = canvas->getMatrix();
+  canvas->resetMatrix();
+  canvas->clipRect(repaintRect);
+  canvas->setMatrix(matrix);
+  return repaintRect;
 }
 
 void Window::present(Context* context, int64_t presentationTime) {
@@ -61,7 +114,29 @@ void Window::present(Context* context, int64_t presentationTime) {
     return;
   }
   context->flush();
+  presentDamage = surface ? surface->getDamagedBounds() : Rect::MakeEmpty();
   onPresent(context, presentationTime);
+  finishFrame();
+}
+
+void Window::finishFrame() {
+  if (surface == nullptr) {
+    return;
+  }
+  auto damage = presentDamage;
+  if (damage.isEmpty()) {
+    damage = Rect::MakeWH(surface->width(), surface->height());
+  }
+  damageHistory.push_back(damage);
+  if (damageHistory.size() > MaxDamageHistory) {
+    damageHistory.pop_front();
+  }
+  surface->resetDamage();
+  presentDamage.setEmpty();
+  if (hasDirtyRect) {
+    surface->getCanvas()->restoreToCount(dirtySaveCount);
+    hasDirtyRect = false;
+  }
 }
 
 void Window::onFreeSurface() {
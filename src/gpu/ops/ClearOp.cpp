@@ -20,8 +20,9 @@
 #include "gpu/RenderPass.h"
 
 namespace tgfx {
-std::unique_ptr<ClearOp> ClearOp::Make(Color color, const Rect& scissor) {
-  return std::unique_ptr<ClearOp>(new ClearOp(color, scissor));
+std::unique_ptr<ClearOp> ClearOp::Make(Color color, const Rect& scissor,
+                                       const Rect& deviceBounds) {
+  return std::unique_ptr<ClearOp>(new ClearOp(color, scissor, deviceBounds));
 }
 
 bool ContainsScissor(const Rect& a, const Rect& b) {
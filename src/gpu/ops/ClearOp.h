@@ -25,13 +25,21 @@ class ClearOp : public Op {
  public:
   DEFINE_OP_CLASS_ID
 
-  static std::unique_ptr<ClearOp> Make(Color color, const Rect& scissor);
+  /**
+   * Creates a ClearOp that fills the scissor area with the color, an empty scissor means the whole
+   * render target. The deviceBounds is the same area in device space with a top-left origin, which
+   * is used as the bounds of the op.
+   */
+  static std::unique_ptr<ClearOp> Make(Color color, const Rect& scissor,
+                                       const Rect& deviceBounds = Rect::MakeEmpty());
 
   void execute(RenderPass* renderPass) override;
 
  private:
-  explicit ClearOp(Color color, const Rect& scissor)
+  ClearOp(Color color, const Rect& scissor, const Rect& deviceBounds)
       : Op(ClassID()), color(color), scissor(scissor) {
+    setBounds(deviceBounds);
+    setOpaqueBounds(deviceBounds);
   }
 
   bool onCombineIfPossible(Op* op) override;
@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ConvexPathOp.h"
+#include "core/PathRef.h"
+#include "core/PathTriangulator.h"
+#include "gpu/Gpu.h"
+#include "gpu/ProxyProvider.h"
+#include "gpu/processors/DefaultGeometryProcessor.h"
+
+namespace tgfx {
+class ConvexPathTriangles : public DataProvider {
+ public:
+  ConvexPathTriangles(Path path, const Matrix& matrix, AAType aaType)
+      : path(std::move(path)), matrix(matrix), aaType(aaType) {
+  }
+
+  std::shared_ptr<Data> getData() const override {
+    std::vector<float> vertices = {};
+    auto finalPath = path;
+    finalPath.transform(matrix);
+    size_t count = 0;
+    if (aaType == AAType::Coverage) {
+      count = PathTriangulator::ToConvexAATriangles(finalPath, &vertices);
+      if (count == 0) {
+        // The path is too thin for the alpha ramps, fall back to the general tessellator.
+        count = PathTriangulator::ToAATriangles(finalPath, finalPath.getBounds(), &vertices);
+      }
+    } else {
+      count = PathTriangulator::ToConvexTriangles(finalPath, &vertices);
+      if (count == 0) {
+        count = PathTriangulator::ToTriangles(finalPath, finalPath.getBounds(), &vertices);
+      }
+    }
+    if (count == 0) {
+      return nullptr;
+    }
+    return Data::MakeWithCopy(vertices.data(), vertices.size() * sizeof(float));
+  }
+
+ private:
+  Path path = {};
+  Matrix matrix = Matrix::I();
+  AAType aaType = AAType::None;
+};
+
+bool ConvexPathOp::CanDraw(const Path& path) {
+  return !path.isInverseFillType() && PathRef::IsConvex(path);
+}
+
+std::unique_ptr<ConvexPathOp> ConvexPathOp::Make(Color color, const Path& path,
+                                                 const Matrix& viewMatrix, uint32_t renderFlags) {
+  if (path.isEmpty() || !CanDraw(path)) {
+    return nullptr;
+  }
+  return std::unique_ptr<ConvexPathOp>(new ConvexPathOp(color, path, viewMatrix, renderFlags));
+}
+
+ConvexPathOp::ConvexPathOp(Color color, Path p, const Matrix& viewMatrix, uint32_t renderFlags)
+    : DrawOp(ClassID()), color(color), path(std::move(p)), viewMatrix(viewMatrix),
+      renderFlags(renderFlags) {
+  auto bounds = path.getBounds();
+  viewMatrix.mapRect(&bounds);
+  setBounds(bounds);
+}
+
+bool ConvexPathOp::onCombineIfPossible(Op*) {
+  return false;
+}
+
+void ConvexPathOp::prepare(Context* context) {
+  static const auto ConvexPathType = UniqueID::Next();
+  // The vertices are generated in a space that only removes the translation of the view matrix,
+  // so that the curve tolerance and the alpha ramps are measured in device pixels, and moving the
+  // path does not invalidate the cached vertices.
+  rasterizeMatrix = viewMatrix;
+  rasterizeMatrix.setTranslateX(0);
+  rasterizeMatrix.setTranslateY(0);
+  BytesKey bytesKey(6);
+  bytesKey.write(ConvexPathType);
+  bytesKey.write(static_cast<uint32_t>(aa));
+  bytesKey.write(rasterizeMatrix.getScaleX());
+  bytesKey.write(rasterizeMatrix.getSkewX());
+  bytesKey.write(rasterizeMatrix.getSkewY());
+  bytesKey.write(rasterizeMatrix.getScaleY());
+  auto uniqueKey = UniqueKey::Combine(PathRef::GetUniqueKey(path), bytesKey);
+  auto pathTriangles = std::make_shared<ConvexPathTriangles>(path, rasterizeMatrix, aa);
+  vertexBuffer = context->proxyProvider()->createGpuBufferProxy(uniqueKey, pathTriangles,
+                                                                BufferType::Vertex, renderFlags);
+}
+
+void ConvexPathOp::execute(RenderPass* renderPass) {
+  auto buffer = vertexBuffer ? vertexBuffer->getBuffer() : nullptr;
+  if (buffer == nullptr) {
+    return;
+  }
+  Matrix localMatrix = {};
+  if (!rasterizeMatrix.invert(&localMatrix)) {
+    return;
+  }
+  auto realViewMatrix = viewMatrix;
+  realViewMatrix.preConcat(localMatrix);
+  auto pipeline = createPipeline(
+      renderPass, DefaultGeometryProcessor::Make(color, renderPass->renderTarget()->width(),
+                                                 renderPass->renderTarget()->height(), aa,
+                                                 realViewMatrix, localMatrix));
+  renderPass->bindProgramAndScissorClip(pipeline.get(), scissorRect());
+  renderPass->bindBuffers(nullptr, buffer);
+  auto vertexCount = aa == AAType::Coverage ? PathTriangulator::GetAATriangleCount(buffer->size())
+                                            : PathTriangulator::GetTriangleCount(buffer->size());
+  renderPass->draw(PrimitiveType::Triangles, 0, vertexCount);
+}
+}  // namespace tgfx
@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "DrawOp.h"
+#include "gpu/GpuBuffer.h"
+#include "tgfx/core/Path.h"
+
+namespace tgfx {
+/**
+ * ConvexPathOp fills a convex path with a triangle fan and analytic antialiasing along its edges,
+ * which is much cheaper than the general tessellator.
+ */
+class ConvexPathOp : public DrawOp {
+ public:
+  DEFINE_OP_CLASS_ID
+
+  /**
+   * Returns true if the path can be drawn by a ConvexPathOp when filled.
+   */
+  static bool CanDraw(const Path& path);
+
+  static std::unique_ptr<ConvexPathOp> Make(Color color, const Path& path,
+                                            const Matrix& viewMatrix, uint32_t renderFlags = 0);
+
+  void prepare(Context* context) override;
+
+  void execute(RenderPass* renderPass) override;
+
+ protected:
+  bool onCombineIfPossible(Op* op) override;
+
+ private:
+  Color color = Color::Transparent();
+  Path path = {};
+  Matrix viewMatrix = Matrix::I();
+  Matrix rasterizeMatrix = Matrix::I();
+  uint32_t renderFlags = 0;
+  std::shared_ptr<GpuBufferProxy> vertexBuffer = nullptr;
+
+  ConvexPathOp(Color color, Path path, const Matrix& viewMatrix, uint32_t renderFlags);
+};
+}  // namespace tgfx
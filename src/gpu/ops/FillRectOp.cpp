@@ -20,23 +20,31 @@
 #include "gpu/Gpu.h"
 #include "gpu/Quad.h"
 #include "gpu/ResourceProvider.h"
+#include "gpu/VertexFormat.h"
 #include "gpu/processors/QuadPerEdgeAAGeometryProcessor.h"
 #include "tgfx/utils/Buffer.h"
 #include "utils/UniqueID.h"
 
 namespace tgfx {
+static constexpr uint8_t kLeftEdge = 1 << 0;
+static constexpr uint8_t kTopEdge = 1 << 1;
+static constexpr uint8_t kRightEdge = 1 << 2;
+static constexpr uint8_t kBottomEdge = 1 << 3;
+static constexpr uint8_t kAllEdges = kLeftEdge | kTopEdge | kRightEdge | kBottomEdge;
+
 class RectPaint {
  public:
   RectPaint(std::optional<Color> color, const Rect& rect, const Matrix& viewMatrix,
-            const Matrix* localMatrix)
+            const Matrix* localMatrix, uint8_t aaEdges = kAllEdges)
       : color(color.value_or(Color::White())), rect(rect), viewMatrix(viewMatrix),
-        localMatrix(localMatrix ? *localMatrix : Matrix::I()) {
+        localMatrix(localMatrix ? *localMatrix : Matrix::I()), aaEdges(aaEdges) {
   }
 
   Color color;
   Rect rect;
   Matrix viewMatrix;
   Matrix localMatrix;
+  uint8_t aaEdges;
 };
 
 class RectCoverageVerticesProvider : public DataProvider {
@@ -46,7 +54,8 @@ class RectCoverageVerticesProvider : public DataProvider {
   }
 
   std::shared_ptr<Data> getData() const override {
-    auto floatCount = rectPaints.size() * 2 * 4 * (hasColor ? 9 : 5);
+    // Each vertex has a position with coverage, a local coordinate, and an optional packed color.
+    auto floatCount = rectPaints.size() * 2 * 4 * (hasColor ? 6 : 5);
     Buffer buffer(floatCount * sizeof(float));
     auto vertices = reinterpret_cast<float*>(buffer.data());
     auto index = 0;
@@ -58,9 +67,27 @@ class RectCoverageVerticesProvider : public DataProvider {
                          viewMatrix.getSkewY() * viewMatrix.getSkewY());
       // we want the new edge to be .5px away from the old line.
       auto padding = 0.5f / scale;
-      auto insetBounds = rect.makeInset(padding, padding);
+      auto insetBounds = rect;
+      auto outsetBounds = rect;
+      // Edges without antialiasing keep full coverage up to the rect boundary.
+      auto aaEdges = rectPaint->aaEdges;
+      if (aaEdges & kLeftEdge) {
+        insetBounds.left += padding;
+        outsetBounds.left -= padding;
+      }
+      if (aaEdges & kTopEdge) {
+        insetBounds.top += padding;
+        outsetBounds.top -= padding;
+      }
+      if (aaEdges & kRightEdge) {
+        insetBounds.right -= padding;
+        outsetBounds.right += padding;
+      }
+      if (aaEdges & kBottomEdge) {
+        insetBounds.bottom -= padding;
+        outsetBounds.bottom += padding;
+      }
       auto insetQuad = Quad::MakeFromRect(insetBounds, viewMatrix);
-      auto outsetBounds = rect.makeOutset(padding, padding);
       auto outsetQuad = Quad::MakeFromRect(outsetBounds, viewMatrix);
 
       auto normalInsetQuad = Quad::MakeFromRect(insetBounds, localMatrix);
@@ -77,11 +104,7 @@ class RectCoverageVerticesProvider : public DataProvider {
           vertices[index++] = normalQuad.point(k).x;
           vertices[index++] = normalQuad.point(k).y;
           if (hasColor) {
-            auto& color = rectPaint->color;
-            vertices[index++] = color.red;
-            vertices[index++] = color.green;
-            vertices[index++] = color.blue;
-            vertices[index++] = color.alpha;
+            WriteUByte4Color(vertices, index, rectPaint->color);
           }
         }
       }
@@ -101,7 +124,7 @@ class RectNonCoverageVerticesProvider : public DataProvider {
   }
 
   std::shared_ptr<Data> getData() const override {
-    auto floatCount = rectPaints.size() * 4 * (hasColor ? 9 : 5);
+    auto floatCount = rectPaints.size() * 4 * (hasColor ? 5 : 4);
     Buffer buffer(floatCount * sizeof(float));
     auto vertices = reinterpret_cast<float*>(buffer.data());
     auto index = 0;
@@ -117,11 +140,7 @@ class RectNonCoverageVerticesProvider : public DataProvider {
         vertices[index++] = localQuad.point(j - 1).x;
         vertices[index++] = localQuad.point(j - 1).y;
         if (hasColor) {
-          auto& color = rectPaint->color;
-          vertices[index++] = color.red;
-          vertices[index++] = color.green;
-          vertices[index++] = color.blue;
-          vertices[index++] = color.alpha;
+          WriteUByte4Color(vertices, index, rectPaint->color);
         }
       }
     }
@@ -147,6 +166,103 @@ FillRectOp::FillRectOp(std::optional<Color> color, const Rect& rect, const Matri
   setBounds(bounds);
 }
 
+std::unique_ptr<FillRectOp> FillRectOp::Make(std::optional<Color> color, const Rect* rects,
+                                             size_t rectCount, const Matrix& viewMatrix) {
+  if (rects == nullptr || rectCount == 0 || rectCount > ResourceProvider::MaxNumQuadsPerDraw()) {
+    return nullptr;
+  }
+  return std::unique_ptr<FillRectOp>(new FillRectOp(color, rects, rectCount, viewMatrix));
+}
+
+FillRectOp::FillRectOp(std::optional<Color> color, const Rect* rects, size_t rectCount,
+                       const Matrix& viewMatrix)
+    : DrawOp(ClassID()), hasColor(color) {
+  rectPaints.reserve(rectCount);
+  auto bounds = Rect::MakeEmpty();
+  for (size_t i = 0; i < rectCount; i++) {
+    rectPaints.push_back(std::make_shared<RectPaint>(color, rects[i], viewMatrix, nullptr));
+    bounds.join(rects[i]);
+  }
+  setTransformedBounds(bounds, viewMatrix);
+}
+
+static uint8_t GetGridAAEdges(const Rect& rect, const Rect& gridBounds) {
+  uint8_t aaEdges = 0;
+  if (rect.left <= gridBounds.left) {
+    aaEdges |= kLeftEdge;
+  }
+  if (rect.top <= gridBounds.top) {
+    aaEdges |= kTopEdge;
+  }
+  if (rect.right >= gridBounds.right) {
+    aaEdges |= kRightEdge;
+  }
+  if (rect.bottom >= gridBounds.bottom) {
+    aaEdges |= kBottomEdge;
+  }
+  return aaEdges;
+}
+
+std::unique_ptr<FillRectOp> FillRectOp::MakeGrid(std::optional<Color> color, const Rect* rects,
+                                                 const Matrix* localMatrices, size_t rectCount,
+                                                 const Matrix& viewMatrix) {
+  auto op = Make(color, rects, rectCount, viewMatrix);
+  if (op == nullptr) {
+    return nullptr;
+  }
+  auto bounds = Rect::MakeEmpty();
+  for (size_t i = 0; i < rectCount; i++) {
+    bounds.join(rects[i]);
+  }
+  for (size_t i = 0; i < rectCount; i++) {
+    auto& rectPaint = op->rectPaints[i];
+    rectPaint->localMatrix = localMatrices[i];
+    rectPaint->aaEdges = GetGridAAEdges(rectPaint->rect, bounds);
+  }
+  return op;
+}
+
+std::unique_ptr<FillRectOp> FillRectOp::MakeGridCell(std::optional<Color> color, const Rect& rect,
+                                                     const Rect& gridBounds,
+                                                     const Matrix& viewMatrix) {
+  auto op = Make(color, rect, viewMatrix);
+  op->rectPaints[0]->aaEdges = GetGridAAEdges(rect, gridBounds);
+  return op;
+}
+
+std::unique_ptr<FillRectOp> FillRectOp::Make(std::optional<Color> color, const Rect* rects,
+                                             const Matrix* viewMatrices,
+                                             const Matrix* localMatrices, size_t rectCount) {
+  auto op = Make(color, rects, rectCount, Matrix::I());
+  if (op == nullptr) {
+    return nullptr;
+  }
+  auto bounds = Rect::MakeEmpty();
+  for (size_t i = 0; i < rectCount; i++) {
+    auto& rectPaint = op->rectPaints[i];
+    rectPaint->viewMatrix = viewMatrices[i];
+    rectPaint->localMatrix = localMatrices[i];
+    bounds.join(viewMatrices[i].mapRect(rects[i]));
+  }
+  op->setBounds(bounds);
+  return op;
+}
+
+static constexpr float BOUNDS_TOLERANCE = 1e-3f;
+
+bool FillRectOp::isPixelAligned() const {
+  for (auto& rectPaint : rectPaints) {
+    auto rect = rectPaint->viewMatrix.mapRect(rectPaint->rect);
+    if (fabsf(roundf(rect.left) - rect.left) > BOUNDS_TOLERANCE ||
+        fabsf(roundf(rect.top) - rect.top) > BOUNDS_TOLERANCE ||
+        fabsf(roundf(rect.right) - rect.right) > BOUNDS_TOLERANCE ||
+        fabsf(roundf(rect.bottom) - rect.bottom) > BOUNDS_TOLERANCE) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool FillRectOp::canAdd(size_t count) const {
   return rectPaints.size() + count <=
          static_cast<size_t>(aa == AAType::Coverage ? ResourceProvider::MaxNumAAQuads()
@@ -175,11 +291,8 @@ void FillRectOp::prepare(Context* context) {
     vertexData = std::make_shared<RectNonCoverageVerticesProvider>(rectPaints, hasColor);
   }
   vertexBufferProxy = GpuBufferProxy::MakeFrom(context, std::move(vertexData), BufferType::Vertex);
-  if (aa == AAType::Coverage) {
-    indexBufferProxy = context->resourceProvider()->aaQuadIndexBuffer();
-  } else {
-    indexBufferProxy = context->resourceProvider()->nonAAQuadIndexBuffer();
-  }
+  indexBufferProxy =
+      context->resourceProvider()->quadIndexBuffer(aa == AAType::Coverage, rectPaints.size());
 }
 
 void FillRectOp::execute(RenderPass* renderPass) {
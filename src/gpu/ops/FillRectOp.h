@@ -32,6 +32,51 @@ class FillRectOp : public DrawOp {
                                           const Matrix& viewMatrix,
                                           const Matrix* localMatrix = nullptr);
 
+  /**
+   * Creates a FillRectOp that draws all the given rects with the same color and view matrix. The
+   * number of rects must not exceed ResourceProvider::MaxNumQuadsPerDraw().
+   */
+  static std::unique_ptr<FillRectOp> Make(std::optional<Color> color, const Rect* rects,
+                                          size_t rectCount, const Matrix& viewMatrix);
+
+  /**
+   * Creates a FillRectOp that draws a grid of adjoining rects with the same color and view matrix,
+   * each with its own local matrix. Only the edges on the outer boundary of the grid are
+   * antialiased, so adjoining rects join without seams.
+   */
+  static std::unique_ptr<FillRectOp> MakeGrid(std::optional<Color> color, const Rect* rects,
+                                              const Matrix* localMatrices, size_t rectCount,
+                                              const Matrix& viewMatrix);
+
+  /**
+   * Creates a FillRectOp that draws one cell of a grid of adjoining rects. Only the edges of the
+   * cell on the outer boundary of the grid are antialiased.
+   */
+  static std::unique_ptr<FillRectOp> MakeGridCell(std::optional<Color> color, const Rect& rect,
+                                                  const Rect& gridBounds,
+                                                  const Matrix& viewMatrix);
+
+  /**
+   * Creates a FillRectOp that draws all the given rects with the same color, each with its own view
+   * matrix and local matrix. The number of rects must not exceed
+   * ResourceProvider::MaxNumQuadsPerDraw().
+   */
+  static std::unique_ptr<FillRectOp> Make(std::optional<Color> color, const Rect* rects,
+                                          const Matrix* viewMatrices, const Matrix* localMatrices,
+                                          size_t rectCount);
+
+  /**
+   * Returns the number of rects drawn by this op.
+   */
+  size_t rectCount() const {
+    return rectPaints.size();
+  }
+
+  /**
+   * Returns true if every rect of this op maps to pixel-aligned device bounds.
+   */
+  bool isPixelAligned() const;
+
   void prepare(Context* context) override;
 
   void execute(RenderPass* renderPass) override;
@@ -40,6 +85,9 @@ class FillRectOp : public DrawOp {
   FillRectOp(std::optional<Color> color, const Rect& rect, const Matrix& viewMatrix,
              const Matrix* localMatrix = nullptr);
 
+  FillRectOp(std::optional<Color> color, const Rect* rects, size_t rectCount,
+             const Matrix& viewMatrix);
+
   bool onCombineIfPossible(Op* op) override;
 
   bool canAdd(size_t count) const;
@@ -33,6 +33,11 @@ bool Op::combineIfPossible(Op* op) {
   auto result = onCombineIfPossible(op);
   if (result) {
     _bounds.join(op->_bounds);
+    // Only one opaque area is tracked, so keep the larger one.
+    if (op->_opaqueBounds.width() * op->_opaqueBounds.height() >
+        _opaqueBounds.width() * _opaqueBounds.height()) {
+      _opaqueBounds = op->_opaqueBounds;
+    }
   }
   return result;
 }
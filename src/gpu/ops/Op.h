@@ -55,6 +55,19 @@ class Op {
     return _classID;
   }
 
+  /**
+   * Returns the area in device space that this op overwrites completely, regardless of what is
+   * already in the render target. Ops recorded earlier whose bounds lie inside this area can be
+   * skipped. Returns an empty Rect if the op does not overwrite any area completely.
+   */
+  const Rect& opaqueBounds() const {
+    return _opaqueBounds;
+  }
+
+  void setOpaqueBounds(const Rect& rect) {
+    _opaqueBounds = rect;
+  }
+
  protected:
   static uint8_t GenOpClassID();
 
@@ -73,5 +86,6 @@ class Op {
  private:
   uint8_t _classID = 0;
   Rect _bounds = Rect::MakeEmpty();
+  Rect _opaqueBounds = Rect::MakeEmpty();
 };
 }  // namespace tgfx
@@ -19,6 +19,7 @@
 #include "RRectOp.h"
 #include "gpu/Gpu.h"
 #include "gpu/GpuBuffer.h"
+#include "gpu/VertexFormat.h"
 #include "gpu/processors/EllipseGeometryProcessor.h"
 #include "tgfx/utils/Buffer.h"
 #include "utils/MathExtra.h"
@@ -114,13 +115,6 @@ class RRectPaint {
   Matrix viewMatrix;
 };
 
-void WriteColor(float* vertices, int& index, const Color& color) {
-  vertices[index++] = color.red;
-  vertices[index++] = color.green;
-  vertices[index++] = color.blue;
-  vertices[index++] = color.alpha;
-}
-
 class RRectVerticesProvider : public DataProvider {
  public:
   RRectVerticesProvider(std::vector<std::shared_ptr<RRectPaint>> rRectPaints, AAType aaType,
@@ -129,7 +123,7 @@ class RRectVerticesProvider : public DataProvider {
   }
 
   std::shared_ptr<Data> getData() const override {
-    auto floatCount = rRectPaints.size() * 4 * 48;
+    auto floatCount = rRectPaints.size() * 4 * 36;
     if (useScale) {
       floatCount += rRectPaints.size() * 4 * 4;
     }
@@ -186,7 +180,7 @@ class RRectVerticesProvider : public DataProvider {
         viewMatrix.mapPoints(&point, 1);
         vertices[index++] = point.x;
         vertices[index++] = point.y;
-        WriteColor(vertices, index, color);
+        WriteUByte4Color(vertices, index, color);
         vertices[index++] = xMaxOffset;
         vertices[index++] = yOuterOffsets[i];
         if (useScale) {
@@ -201,7 +195,7 @@ class RRectVerticesProvider : public DataProvider {
         viewMatrix.mapPoints(&point, 1);
         vertices[index++] = point.x;
         vertices[index++] = point.y;
-        WriteColor(vertices, index, color);
+        WriteUByte4Color(vertices, index, color);
         vertices[index++] = FLOAT_NEARLY_ZERO;
         vertices[index++] = yOuterOffsets[i];
         if (useScale) {
@@ -216,7 +210,7 @@ class RRectVerticesProvider : public DataProvider {
         viewMatrix.mapPoints(&point, 1);
         vertices[index++] = point.x;
         vertices[index++] = point.y;
-        WriteColor(vertices, index, color);
+        WriteUByte4Color(vertices, index, color);
         vertices[index++] = FLOAT_NEARLY_ZERO;
         vertices[index++] = yOuterOffsets[i];
         if (useScale) {
@@ -231,7 +225,7 @@ class RRectVerticesProvider : public DataProvider {
         viewMatrix.mapPoints(&point, 1);
         vertices[index++] = point.x;
         vertices[index++] = point.y;
-        WriteColor(vertices, index, color);
+        WriteUByte4Color(vertices, index, color);
         vertices[index++] = xMaxOffset;
         vertices[index++] = yOuterOffsets[i];
         if (useScale) {
@@ -276,12 +270,16 @@ class RRectIndicesProvider : public DataProvider {
   std::vector<std::shared_ptr<RRectPaint>> rRectPaints = {};
 };
 
+bool RRectOp::CanDraw(const RRect& rRect) {
+  return 0.5f <= rRect.radii.x && 0.5f <= rRect.radii.y;
+}
+
 std::unique_ptr<RRectOp> RRectOp::Make(Color color, const RRect& rRect, const Matrix& viewMatrix) {
   Matrix matrix = Matrix::I();
   if (!viewMatrix.invert(&matrix)) {
     return nullptr;
   }
-  if (/*!isStrokeOnly && */ 0.5f <= rRect.radii.x && 0.5f <= rRect.radii.y) {
+  if (/*!isStrokeOnly && */ CanDraw(rRect)) {
     return std::unique_ptr<RRectOp>(new RRectOp(color, rRect, viewMatrix, matrix));
   }
   return nullptr;
@@ -295,11 +293,51 @@ RRectOp::RRectOp(Color color, const RRect& rRect, const Matrix& viewMatrix,
   rRectPaints.push_back(std::move(rRectPaint));
 }
 
+std::unique_ptr<RRectOp> RRectOp::Make(Color color, const RRect* rRects, size_t rRectCount,
+                                       const Matrix& viewMatrix) {
+  if (rRects == nullptr || rRectCount == 0 || rRectCount > MaxNumRRects()) {
+    return nullptr;
+  }
+  Matrix matrix = Matrix::I();
+  if (!viewMatrix.invert(&matrix)) {
+    return nullptr;
+  }
+  auto op = std::unique_ptr<RRectOp>(new RRectOp(color, rRects, rRectCount, viewMatrix, matrix));
+  if (op->rRectPaints.empty()) {
+    return nullptr;
+  }
+  return op;
+}
+
+RRectOp::RRectOp(Color color, const RRect* rRects, size_t rRectCount, const Matrix& viewMatrix,
+                 const Matrix& localMatrix)
+    : DrawOp(ClassID()), localMatrix(localMatrix) {
+  rRectPaints.reserve(rRectCount);
+  auto bounds = Rect::MakeEmpty();
+  for (size_t i = 0; i < rRectCount; i++) {
+    auto& rRect = rRects[i];
+    if (!CanDraw(rRect)) {
+      continue;
+    }
+    rRectPaints.push_back(std::make_shared<RRectPaint>(color, 0.f, 0.f, rRect, viewMatrix));
+    bounds.join(rRect.rect);
+  }
+  setTransformedBounds(bounds, viewMatrix);
+}
+
+// Each rRect uses 16 vertices, which must all be addressable by 16-bit indices.
+static constexpr size_t kMaxNumRRects = (1 << 16) / 16;
+
+size_t RRectOp::MaxNumRRects() {
+  return kMaxNumRRects;
+}
+
 bool RRectOp::onCombineIfPossible(Op* op) {
-  if (!DrawOp::onCombineIfPossible(op)) {
+  auto* that = static_cast<RRectOp*>(op);
+  if (rRectPaints.size() + that->rRectPaints.size() > kMaxNumRRects ||
+      !DrawOp::onCombineIfPossible(op)) {
     return false;
   }
-  auto* that = static_cast<RRectOp*>(op);
   if (localMatrix != that->localMatrix) {
     return false;
   }
@@ -28,8 +28,26 @@ class RRectOp : public DrawOp {
  public:
   DEFINE_OP_CLASS_ID
 
+  /**
+   * Returns true if the given rRect can be drawn by a RRectOp. RRects with radii less than 0.5 must
+   * be drawn as paths instead.
+   */
+  static bool CanDraw(const RRect& rRect);
+
   static std::unique_ptr<RRectOp> Make(Color color, const RRect& rRect, const Matrix& viewMatrix);
 
+  /**
+   * Creates a RRectOp that draws all the given rRects with the same color and view matrix. RRects
+   * with radii less than 0.5 are skipped. The number of rRects must not exceed MaxNumRRects().
+   */
+  static std::unique_ptr<RRectOp> Make(Color color, const RRect* rRects, size_t rRectCount,
+                                       const Matrix& viewMatrix);
+
+  /**
+   * Returns the maximum number of rRects that can be drawn by a single RRectOp.
+   */
+  static size_t MaxNumRRects();
+
   void prepare(Context* context) override;
 
   void execute(RenderPass* renderPass) override;
@@ -37,6 +55,9 @@ class RRectOp : public DrawOp {
  private:
   RRectOp(Color color, const RRect& rRect, const Matrix& viewMatrix, const Matrix& localMatrix);
 
+  RRectOp(Color color, const RRect* rRects, size_t rRectCount, const Matrix& viewMatrix,
+          const Matrix& localMatrix);
+
   bool onCombineIfPossible(Op* op) override;
 
   std::vector<std::shared_ptr<RRectPaint>> rRectPaints;
@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "VerticesOp.h"
+#include "core/DataProvider.h"
+#include "gpu/Gpu.h"
+#include "gpu/VertexFormat.h"
+#include "gpu/processors/QuadPerEdgeAAGeometryProcessor.h"
+#include "tgfx/utils/Buffer.h"
+
+namespace tgfx {
+class MeshVerticesProvider : public DataProvider {
+ public:
+  MeshVerticesProvider(Color color, std::shared_ptr<Vertices> vertices, const Matrix& viewMatrix)
+      : color(color), vertices(std::move(vertices)), viewMatrix(viewMatrix) {
+  }
+
+  std::shared_ptr<Data> getData() const override {
+    auto& positions = vertices->positions();
+    auto& texCoords = vertices->texCoords();
+    auto& colors = vertices->colors();
+    auto vertexCount = positions.size();
+    // Each vertex has a device position, a local coordinate, and a packed premultiplied color.
+    Buffer buffer(vertexCount * 5 * sizeof(float));
+    auto data = reinterpret_cast<float*>(buffer.data());
+    // Maps all positions in one batch so the matrix kernel can process them in vector registers.
+    std::vector<Point> devicePositions(vertexCount);
+    viewMatrix.mapPoints(devicePositions.data(), positions.data(), static_cast<int>(vertexCount));
+    auto index = 0;
+    for (size_t i = 0; i < vertexCount; ++i) {
+      auto& position = devicePositions[i];
+      auto& localCoord = texCoords.empty() ? positions[i] : texCoords[i];
+      auto vertexColor = color;
+      if (!colors.empty()) {
+        vertexColor = colors[i].premultiply();
+        vertexColor.red *= color.alpha;
+        vertexColor.green *= color.alpha;
+        vertexColor.blue *= color.alpha;
+        vertexColor.alpha *= color.alpha;
+      }
+      data[index++] = position.x;
+      data[index++] = position.y;
+      data[index++] = localCoord.x;
+      data[index++] = localCoord.y;
+      WriteUByte4Color(data, index, vertexColor);
+    }
+    return buffer.release();
+  }
+
+ private:
+  Color color = Color::Transparent();
+  std::shared_ptr<Vertices> vertices = nullptr;
+  Matrix viewMatrix = Matrix::I();
+};
+
+class MeshIndicesProvider : public DataProvider {
+ public:
+  explicit MeshIndicesProvider(std::shared_ptr<Vertices> vertices)
+      : vertices(std::move(vertices)) {
+  }
+
+  std::shared_ptr<Data> getData() const override {
+    // The provider keeps the vertices alive until the upload finishes, so no copy is needed.
+    auto& indices = vertices->indices();
+    return Data::MakeWithoutCopy(indices.data(), indices.size() * sizeof(uint16_t));
+  }
+
+ private:
+  std::shared_ptr<Vertices> vertices = nullptr;
+};
+
+std::unique_ptr<VerticesOp> VerticesOp::Make(Color color, std::shared_ptr<Vertices> vertices,
+                                             const Matrix& viewMatrix) {
+  if (vertices == nullptr) {
+    return nullptr;
+  }
+  return std::unique_ptr<VerticesOp>(new VerticesOp(color, std::move(vertices), viewMatrix));
+}
+
+VerticesOp::VerticesOp(Color color, std::shared_ptr<Vertices> vertices, const Matrix& viewMatrix)
+    : DrawOp(ClassID()), color(color), vertices(std::move(vertices)), viewMatrix(viewMatrix) {
+  setBounds(viewMatrix.mapRect(this->vertices->bounds()));
+}
+
+bool VerticesOp::onCombineIfPossible(Op*) {
+  return false;
+}
+
+void VerticesOp::prepare(Context* context) {
+  auto vertexData = std::make_shared<MeshVerticesProvider>(color, vertices, viewMatrix);
+  vertexBufferProxy = GpuBufferProxy::MakeFrom(context, std::move(vertexData), BufferType::Vertex);
+  if (vertices->indexCount() > 0) {
+    auto indexData = std::make_shared<MeshIndicesProvider>(vertices);
+    indexBufferProxy = GpuBufferProxy::MakeFrom(context, std::move(indexData), BufferType::Index);
+  }
+}
+
+void VerticesOp::execute(RenderPass* renderPass) {
+  if (vertexBufferProxy == nullptr) {
+    return;
+  }
+  auto vertexBuffer = vertexBufferProxy->getBuffer();
+  if (vertexBuffer == nullptr) {
+    return;
+  }
+  std::shared_ptr<GpuBuffer> indexBuffer = nullptr;
+  if (vertices->indexCount() > 0) {
+    if (indexBufferProxy == nullptr) {
+      return;
+    }
+    indexBuffer = indexBufferProxy->getBuffer();
+    if (indexBuffer == nullptr) {
+      return;
+    }
+  }
+  // Meshes carry no edge coverage, so only multisampling can antialias them.
+  auto aaType = aa == AAType::MSAA ? AAType::MSAA : AAType::None;
+  auto pipeline = createPipeline(
+      renderPass,
+      QuadPerEdgeAAGeometryProcessor::Make(renderPass->renderTarget()->width(),
+                                           renderPass->renderTarget()->height(), aaType, true));
+  renderPass->bindProgramAndScissorClip(pipeline.get(), scissorRect());
+  renderPass->bindBuffers(indexBuffer, vertexBuffer);
+  if (indexBuffer != nullptr) {
+    auto indexCount = vertices->indexCount() / 3 * 3;
+    renderPass->drawIndexed(PrimitiveType::Triangles, 0, indexCount);
+  } else {
+    auto vertexCount = vertices->vertexCount() / 3 * 3;
+    renderPass->draw(PrimitiveType::Triangles, 0, vertexCount);
+  }
+}
+}  // namespace tgfx
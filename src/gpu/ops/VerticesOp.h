@@ -0,0 +1,51 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "gpu/ops/DrawOp.h"
+#include "tgfx/core/Vertices.h"
+
+namespace tgfx {
+/**
+ * VerticesOp draws a client-supplied triangle mesh. The vertices are mapped to device space on the
+ * CPU and uploaded as they are, along with the indices if the mesh has any.
+ */
+class VerticesOp : public DrawOp {
+ public:
+  DEFINE_OP_CLASS_ID
+
+  static std::unique_ptr<VerticesOp> Make(Color color, std::shared_ptr<Vertices> vertices,
+                                          const Matrix& viewMatrix);
+
+  void prepare(Context* context) override;
+
+  void execute(RenderPass* renderPass) override;
+
+ private:
+  Color color = Color::Transparent();
+  std::shared_ptr<Vertices> vertices = nullptr;
+  Matrix viewMatrix = Matrix::I();
+  std::shared_ptr<GpuBufferProxy> vertexBufferProxy = nullptr;
+  std::shared_ptr<GpuBufferProxy> indexBufferProxy = nullptr;
+
+  VerticesOp(Color color, std::shared_ptr<Vertices> vertices, const Matrix& viewMatrix);
+
+  bool onCombineIfPossible(Op* op) override;
+};
+}  // namespace tgfx
@@ -24,7 +24,7 @@ EllipseGeometryProcessor::EllipseGeometryProcessor(int width, int height, bool s
     : GeometryProcessor(ClassID()), width(width), height(height), localMatrix(localMatrix),
       stroke(stroke), useScale(useScale) {
   inPosition = {"inPosition", SLType::Float2};
-  inColor = {"inColor", SLType::Float4};
+  inColor = {"inColor", VertexFormat::UByte4Normalized, SLType::Float4};
   if (useScale) {
     inEllipseOffset = {"inEllipseOffset", SLType::Float3};
   } else {
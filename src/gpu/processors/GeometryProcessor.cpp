@@ -22,28 +22,53 @@ namespace tgfx {
 static constexpr char TRANSFORM_UNIFORM_PREFIX[] = "CoordTransformMatrix_";
 
 /**
- * Returns the size of the attrib type in bytes.
+ * Returns the size of the vertex format in bytes.
  */
-static constexpr size_t VertexAttribTypeSize(SLType type) {
-  switch (type) {
-    case SLType::Float:
+static constexpr size_t VertexFormatSize(VertexFormat format) {
+  switch (format) {
+    case VertexFormat::Float:
       return sizeof(float);
-    case SLType::Float2:
+    case VertexFormat::Float2:
       return 2 * sizeof(float);
-    case SLType::Float3:
+    case VertexFormat::Float3:
       return 3 * sizeof(float);
-    case SLType::Float4:
+    case VertexFormat::Float4:
       return 4 * sizeof(float);
-    case SLType::Int:
+    case VertexFormat::Int:
       return sizeof(int32_t);
-    case SLType::Int2:
+    case VertexFormat::Int2:
       return 2 * sizeof(int32_t);
-    case SLType::Int3:
+    case VertexFormat::Int3:
       return 3 * sizeof(int32_t);
-    case SLType::Int4:
+    case VertexFormat::Int4:
       return 4 * sizeof(int32_t);
+    case VertexFormat::UByte4Normalized:
+      return 4 * sizeof(uint8_t);
+  }
+  return 0;
+}
+
+/**
+ * Returns the vertex format that stores the given shader type without conversion.
+ */
+static VertexFormat DefaultVertexFormat(SLType type) {
+  switch (type) {
+    case SLType::Float2:
+      return VertexFormat::Float2;
+    case SLType::Float3:
+      return VertexFormat::Float3;
+    case SLType::Float4:
+      return VertexFormat::Float4;
+    case SLType::Int:
+      return VertexFormat::Int;
+    case SLType::Int2:
+      return VertexFormat::Int2;
+    case SLType::Int3:
+      return VertexFormat::Int3;
+    case SLType::Int4:
+      return VertexFormat::Int4;
     default:
-      return 0;
+      return VertexFormat::Float;
   }
 }
 
@@ -52,8 +77,12 @@ static constexpr T Align4(T x) {
   return (x + 3) >> 2 << 2;
 }
 
+GeometryProcessor::Attribute::Attribute(std::string name, SLType gpuType)
+    : _name(std::move(name)), _format(DefaultVertexFormat(gpuType)), _gpuType(gpuType) {
+}
+
 size_t GeometryProcessor::Attribute::sizeAlign4() const {
-  return Align4(VertexAttribTypeSize(_gpuType));
+  return Align4(VertexFormatSize(_format));
 }
 
 void GeometryProcessor::computeProcessorKey(Context*, BytesKey* bytesKey) const {
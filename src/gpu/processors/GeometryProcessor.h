@@ -25,6 +25,7 @@
 #include "gpu/UniformBuffer.h"
 #include "gpu/UniformHandler.h"
 #include "gpu/VaryingHandler.h"
+#include "gpu/VertexFormat.h"
 #include "gpu/VertexShaderBuilder.h"
 #include "gpu/processors/FragmentProcessor.h"
 #include "gpu/processors/Processor.h"
@@ -41,7 +42,17 @@ class GeometryProcessor : public Processor {
   class Attribute {
    public:
     Attribute() = default;
-    Attribute(std::string name, SLType gpuType) : _name(std::move(name)), _gpuType(gpuType) {
+
+    /**
+     * Creates an attribute that is stored in the vertex buffer with the same layout as gpuType.
+     */
+    Attribute(std::string name, SLType gpuType);
+
+    /**
+     * Creates an attribute that is stored as format and read by the shader as gpuType.
+     */
+    Attribute(std::string name, VertexFormat format, SLType gpuType)
+        : _name(std::move(name)), _format(format), _gpuType(gpuType) {
     }
 
     bool isInitialized() const {
@@ -51,6 +62,10 @@ class GeometryProcessor : public Processor {
     const std::string& name() const {
       return _name;
     }
+    VertexFormat format() const {
+      return _format;
+    }
+
     SLType gpuType() const {
       return _gpuType;
     }
@@ -62,11 +77,16 @@ class GeometryProcessor : public Processor {
     }
 
     void computeKey(BytesKey* bytesKey) const {
-      bytesKey->write(isInitialized() ? static_cast<uint32_t>(_gpuType) : ~0u);
+      if (!isInitialized()) {
+        bytesKey->write(~0u);
+        return;
+      }
+      bytesKey->write(static_cast<uint32_t>(_gpuType) << 16 | static_cast<uint32_t>(_format));
     }
 
    private:
     std::string _name;
+    VertexFormat _format = VertexFormat::Float;
     SLType _gpuType = SLType::Float;
   };
 
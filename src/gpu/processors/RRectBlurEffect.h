@@ -0,0 +1,54 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "gpu/processors/FragmentProcessor.h"
+
+namespace tgfx {
+/**
+ * RRectBlurEffect outputs the coverage of a rounded rectangle convolved with a Gaussian, evaluated
+ * analytically. The blur is separable along x, where it reduces to a pair of erf() terms, and is
+ * integrated numerically with a few samples along y.
+ */
+class RRectBlurEffect : public FragmentProcessor {
+ public:
+  /**
+   * Creates a new RRectBlurEffect. The rect, cornerRadius and sigma are all specified in the space
+   * that the matrix maps the local coordinates into. The corners must be circular in that space.
+   */
+  static std::unique_ptr<RRectBlurEffect> Make(const Rect& rect, float cornerRadius, float sigma,
+                                               const Matrix& matrix);
+
+  std::string name() const override {
+    return "RRectBlurEffect";
+  }
+
+ protected:
+  DEFINE_PROCESSOR_CLASS_ID
+
+  RRectBlurEffect(const Rect& rect, float cornerRadius, float sigma, const Matrix& matrix);
+
+  bool onIsEqual(const FragmentProcessor& processor) const override;
+
+  CoordTransform coordTransform;
+  Rect rect = Rect::MakeEmpty();
+  float cornerRadius = 0.0f;
+  float sigma = 0.0f;
+};
+}  // namespace tgfx
@@ -0,0 +1,43 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "RuntimeFragmentProcessor.h"
+
+namespace tgfx {
+RuntimeFragmentProcessor::RuntimeFragmentProcessor(
+    std::shared_ptr<RuntimeEffect> effect, std::vector<float> uniformValues,
+    std::vector<std::unique_ptr<FragmentProcessor>> children, const Matrix& matrix)
+    : FragmentProcessor(ClassID()), effect(std::move(effect)),
+      uniformValues(std::move(uniformValues)), coordTransform(matrix) {
+  addCoordTransform(&coordTransform);
+  for (auto& child : children) {
+    registerChildProcessor(std::move(child));
+  }
+}
+
+void RuntimeFragmentProcessor::onComputeProcessorKey(BytesKey* bytesKey) const {
+  // The generated shader code depends on the user code, so every effect needs its own program.
+  bytesKey->write(effectID());
+}
+
+bool RuntimeFragmentProcessor::onIsEqual(const FragmentProcessor& processor) const {
+  const auto& that = static_cast<const RuntimeFragmentProcessor&>(processor);
+  return effectID() == that.effectID() && uniformValues == that.uniformValues &&
+         coordTransform.matrix == that.coordTransform.matrix;
+}
+}  // namespace tgfx
@@ -0,0 +1,54 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "gpu/processors/FragmentProcessor.h"
+#include "tgfx/core/RuntimeEffect.h"
+
+namespace tgfx {
+class RuntimeFragmentProcessor : public FragmentProcessor {
+ public:
+  static std::unique_ptr<RuntimeFragmentProcessor> Make(
+      std::shared_ptr<RuntimeEffect> effect, std::vector<float> uniformValues,
+      std::vector<std::unique_ptr<FragmentProcessor>> children, const Matrix& matrix);
+
+  std::string name() const override {
+    return "RuntimeFragmentProcessor";
+  }
+
+ protected:
+  DEFINE_PROCESSOR_CLASS_ID
+
+  RuntimeFragmentProcessor(std::shared_ptr<RuntimeEffect> effect, std::vector<float> uniformValues,
+                           std::vector<std::unique_ptr<FragmentProcessor>> children,
+                           const Matrix& matrix);
+
+  void onComputeProcessorKey(BytesKey* bytesKey) const override;
+
+  bool onIsEqual(const FragmentProcessor& processor) const override;
+
+  uint32_t effectID() const {
+    return effect->uniqueID;
+  }
+
+  std::shared_ptr<RuntimeEffect> effect;
+  std::vector<float> uniformValues;
+  CoordTransform coordTransform;
+};
+}  // namespace tgfx
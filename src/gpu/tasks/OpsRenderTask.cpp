@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "OpsRenderTask.h"
+#include <algorithm>
 #include "gpu/Gpu.h"
 #include "gpu/RenderPass.h"
 
@@ -29,12 +30,55 @@ void OpsRenderTask::addOp(std::unique_ptr<Op> op) {
 }
 
 void OpsRenderTask::prepare(Context* context) {
+  removeOccludedOps();
   renderPass = context->gpu()->getRenderPass();
   for (auto& op : ops) {
     op->prepare(context);
   }
 }
 
+/**
+ * The maximum number of opaque areas collected while looking for hidden ops. A few large
+ * backgrounds cover the common cases, tracking more would make the pass quadratic.
+ */
+static constexpr size_t MaxOccluderCount = 4;
+
+void OpsRenderTask::removeOccludedOps() {
+  if (ops.size() < 2) {
+    return;
+  }
+  auto rtRect = Rect::MakeWH(renderTargetProxy->width(), renderTargetProxy->height());
+  std::vector<Rect> occluders = {};
+  auto hasHiddenOps = false;
+  for (auto i = ops.size(); i > 0; i--) {
+    auto& op = ops[i - 1];
+    if (!occluders.empty() && !op->bounds().isEmpty()) {
+      // Antialiased ops may touch the pixels just outside their bounds.
+      auto bounds = op->bounds().makeOutset(1.0f, 1.0f);
+      bounds.roundOut();
+      if (bounds.intersect(rtRect)) {
+        for (auto& occluder : occluders) {
+          if (occluder.contains(bounds)) {
+            op = nullptr;
+            hasHiddenOps = true;
+            break;
+          }
+        }
+        if (op == nullptr) {
+          continue;
+        }
+      }
+    }
+    auto& opaqueBounds = op->opaqueBounds();
+    if (!opaqueBounds.isEmpty() && occluders.size() < MaxOccluderCount) {
+      occluders.push_back(opaqueBounds);
+    }
+  }
+  if (hasHiddenOps) {
+    ops.erase(std::remove(ops.begin(), ops.end(), nullptr), ops.end());
+  }
+}
+
 bool OpsRenderTask::execute(Gpu* gpu) {
   if (ops.empty()) {
     return false;
@@ -49,6 +93,10 @@ bool OpsRenderTask::execute(Gpu* gpu) {
   }
   gpu->submit(renderPass.get());
   renderPass->end();
+  auto texture = renderTargetProxy->getTexture();
+  if (texture != nullptr && texture->hasMipmaps()) {
+    texture->setMipmapsDirty(true);
+  }
   return true;
 }
 }  // namespace tgfx
@@ -38,5 +38,7 @@ class OpsRenderTask : public RenderTask {
  private:
   std::shared_ptr<RenderPass> renderPass = nullptr;
   std::vector<std::unique_ptr<Op>> ops = {};
+
+  void removeOccludedOps();
 };
 }  // namespace tgfx
@@ -37,11 +37,10 @@ class ResourceTask {
   bool execute(Context* context);
 
  protected:
-  virtual std::shared_ptr<Resource> onMakeResource(Context* context) = 0;
-
- private:
   UniqueKey uniqueKey = {};
 
+  virtual std::shared_ptr<Resource> onMakeResource(Context* context) = 0;
+
   friend class DrawingManager;
 };
 }  // namespace tgfx
@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "TextureCreateTask.h"
+#include "gpu/ShareGroup.h"
 #include "gpu/Texture.h"
 
 namespace tgfx {
@@ -64,6 +65,15 @@ class ImageDecoderTask : public TextureCreateTask {
     if (decoder == nullptr) {
       return nullptr;
     }
+    auto shareGroup = context->shareGroup();
+    if (shareGroup != nullptr) {
+      // Another context may have uploaded the image since the proxy was created.
+      auto texture = shareGroup->findTexture(context, uniqueKey);
+      if (texture != nullptr) {
+        decoder = nullptr;
+        return texture;
+      }
+    }
     auto imageBuffer = decoder->decode();
     if (imageBuffer == nullptr) {
       LOGE("ImageDecoderTask::onMakeResource() Failed to decode the image!");
@@ -75,6 +85,9 @@ class ImageDecoderTask : public TextureCreateTask {
     } else {
       // Free the decoded image buffer immediately to reduce memory pressure.
       decoder = nullptr;
+      if (shareGroup != nullptr) {
+        texture = shareGroup->shareTexture(context, uniqueKey, std::move(texture));
+      }
     }
     return texture;
   }
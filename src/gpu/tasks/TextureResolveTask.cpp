@@ -34,8 +34,16 @@ bool TextureResolveTask::execute(Gpu* gpu) {
     gpu->resolveRenderTarget(renderTarget.get());
   }
   auto texture = renderTargetProxy->getTexture();
-  if (texture != nullptr && texture->hasMipmaps()) {
+  if (texture == nullptr || !texture->hasMipmaps()) {
+    return true;
+  }
+  // Textures owned by the caller may be modified outside tgfx, so their mipmaps are always
+  // regenerated.
+  auto textureProxy = renderTargetProxy->getTextureProxy();
+  auto externallyOwned = textureProxy != nullptr && textureProxy->externallyOwned();
+  if (texture->mipmapsDirty() || externallyOwned) {
     gpu->regenerateMipmapLevels(texture->getSampler());
+    texture->setMipmapsDirty(false);
   }
   return true;
 }
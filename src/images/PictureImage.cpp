@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PictureImage.h"
+#include "core/MCState.h"
+#include "gpu/ProxyProvider.h"
+#include "gpu/RenderContext.h"
+
+namespace tgfx {
+std::shared_ptr<PictureImage> PictureImage::MakeFrom(std::shared_ptr<Picture> picture, int width,
+                                                     int height, const Matrix& matrix) {
+  if (picture == nullptr || width <= 0 || height <= 0) {
+    return nullptr;
+  }
+  auto image = std::shared_ptr<PictureImage>(
+      new PictureImage(UniqueKey::Make(), std::move(picture), width, height, matrix));
+  image->weakThis = image;
+  return image;
+}
+
+PictureImage::PictureImage(UniqueKey uniqueKey, std::shared_ptr<Picture> picture, int width,
+                           int height, const Matrix& matrix)
+    : ResourceImage(std::move(uniqueKey)), picture(std::move(picture)), _width(width),
+      _height(height), matrix(matrix) {
+}
+
+std::shared_ptr<TextureProxy> PictureImage::onLockTextureProxy(Context* context,
+                                                               const UniqueKey& key, bool mipmapped,
+                                                               uint32_t renderFlags) const {
+  auto proxyProvider = context->proxyProvider();
+  auto textureProxy = std::static_pointer_cast<TextureProxy>(proxyProvider->findProxy(key));
+  if (textureProxy != nullptr) {
+    return textureProxy;
+  }
+  auto hasResourceCache = context->resourceCache()->hasUniqueResource(key);
+  textureProxy = proxyProvider->createTextureProxy(key, _width, _height, PixelFormat::RGBA_8888,
+                                                   mipmapped, ImageOrigin::TopLeft, renderFlags);
+  if (hasResourceCache) {
+    return textureProxy;
+  }
+  auto renderTarget = proxyProvider->createRenderTargetProxy(textureProxy, PixelFormat::RGBA_8888);
+  if (renderTarget == nullptr) {
+    return nullptr;
+  }
+  RenderContext renderContext(renderTarget, renderFlags);
+  renderContext.clear();
+  picture->playback(&renderContext, MCState(matrix));
+  return textureProxy;
+}
+}  // namespace tgfx
@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "images/ResourceImage.h"
+#include "tgfx/core/Picture.h"
+
+namespace tgfx {
+/**
+ * PictureImage rasterizes a Picture into a texture of the given size on the GPU. The texture is
+ * cached in the resource cache by its UniqueKey, so the Picture is only replayed again after the
+ * texture has been purged.
+ */
+class PictureImage : public ResourceImage {
+ public:
+  /**
+   * Creates a PictureImage that draws the picture with the given matrix into an image of the given
+   * size. Returns nullptr if the picture is nullptr or the size is empty.
+   */
+  static std::shared_ptr<PictureImage> MakeFrom(std::shared_ptr<Picture> picture, int width,
+                                                int height, const Matrix& matrix);
+
+  int width() const override {
+    return _width;
+  }
+
+  int height() const override {
+    return _height;
+  }
+
+  bool isAlphaOnly() const override {
+    return false;
+  }
+
+ protected:
+  std::shared_ptr<TextureProxy> onLockTextureProxy(Context* context, const UniqueKey& key,
+                                                   bool mipmapped,
+                                                   uint32_t renderFlags) const override;
+
+ private:
+  std::shared_ptr<Picture> picture = nullptr;
+  int _width = 0;
+  int _height = 0;
+  Matrix matrix = Matrix::I();
+
+  PictureImage(UniqueKey uniqueKey, std::shared_ptr<Picture> picture, int width, int height,
+               const Matrix& matrix);
+};
+}  // namespace tgfx
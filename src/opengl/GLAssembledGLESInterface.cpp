@@ -95,6 +95,20 @@ static void InitVertexArray(const GLProcGetter* getter, GLFunctions* functions,
   }
 }
 
+static void InitSamplerObject(const GLProcGetter* getter, GLFunctions* functions,
+                              const GLInfo& info) {
+  if (info.version >= GL_VER(3, 0)) {
+    functions->bindSampler =
+        reinterpret_cast<GLBindSampler*>(getter->getProcAddress("glBindSampler"));
+    functions->deleteSamplers =
+        reinterpret_cast<GLDeleteSamplers*>(getter->getProcAddress("glDeleteSamplers"));
+    functions->genSamplers =
+        reinterpret_cast<GLGenSamplers*>(getter->getProcAddress("glGenSamplers"));
+    functions->samplerParameteri =
+        reinterpret_cast<GLSamplerParameteri*>(getter->getProcAddress("glSamplerParameteri"));
+  }
+}
+
 void GLAssembleGLESInterface(const GLProcGetter* getter, GLFunctions* functions,
                              const GLInfo& info) {
   if (info.hasExtension("GL_NV_texture_barrier")) {
@@ -105,5 +119,6 @@ void GLAssembleGLESInterface(const GLProcGetter* getter, GLFunctions* functions,
   InitRenderbufferStorageMultisample(getter, functions, info);
   InitFramebufferTexture2DMultisample(getter, functions, info);
   InitVertexArray(getter, functions, info);
+  InitSamplerObject(getter, functions, info);
 }
 }  // namespace tgfx
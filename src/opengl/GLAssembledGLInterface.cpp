@@ -61,6 +61,20 @@ static void InitVertexArray(const GLProcGetter* getter, GLFunctions* functions,
   }
 }
 
+static void InitSamplerObject(const GLProcGetter* getter, GLFunctions* functions,
+                              const GLInfo& info) {
+  if (info.version >= GL_VER(3, 3) || info.hasExtension("GL_ARB_sampler_objects")) {
+    functions->bindSampler =
+        reinterpret_cast<GLBindSampler*>(getter->getProcAddress("glBindSampler"));
+    functions->deleteSamplers =
+        reinterpret_cast<GLDeleteSamplers*>(getter->getProcAddress("glDeleteSamplers"));
+    functions->genSamplers =
+        reinterpret_cast<GLGenSamplers*>(getter->getProcAddress("glGenSamplers"));
+    functions->samplerParameteri =
+        reinterpret_cast<GLSamplerParameteri*>(getter->getProcAddress("glSamplerParameteri"));
+  }
+}
+
 static void InitRenderbufferStorageMultisample(const GLProcGetter* getter, GLFunctions* functions,
                                                const GLInfo& info) {
   if (info.version >= GL_VER(3, 0) || info.hasExtension("GL_ARB_framebuffer_object")) {
@@ -77,5 +91,6 @@ void GLAssembleGLInterface(const GLProcGetter* getter, GLFunctions* functions, c
   InitBlitFrameBuffer(getter, functions, info);
   InitRenderbufferStorageMultisample(getter, functions, info);
   InitVertexArray(getter, functions, info);
+  InitSamplerObject(getter, functions, info);
 }
 }  // namespace tgfx
@@ -40,6 +40,20 @@ static void InitVertexArray(const GLProcGetter* getter, GLFunctions* functions,
   }
 }
 
+static void InitSamplerObject(const GLProcGetter* getter, GLFunctions* functions,
+                              const GLInfo& info) {
+  if (info.version >= GL_VER(2, 0)) {
+    functions->bindSampler =
+        reinterpret_cast<GLBindSampler*>(getter->getProcAddress("glBindSampler"));
+    functions->deleteSamplers =
+        reinterpret_cast<GLDeleteSamplers*>(getter->getProcAddress("glDeleteSamplers"));
+    functions->genSamplers =
+        reinterpret_cast<GLGenSamplers*>(getter->getProcAddress("glGenSamplers"));
+    functions->samplerParameteri =
+        reinterpret_cast<GLSamplerParameteri*>(getter->getProcAddress("glSamplerParameteri"));
+  }
+}
+
 void GLAssembleWebGLInterface(const GLProcGetter* getter, GLFunctions* functions,
                               const GLInfo& info) {
   if (info.version >= GL_VER(2, 0)) {
@@ -49,5 +63,6 @@ void GLAssembleWebGLInterface(const GLProcGetter* getter, GLFunctions* functions
         getter->getProcAddress("glRenderbufferStorageMultisample"));
   }
   InitVertexArray(getter, functions, info);
+  InitSamplerObject(getter, functions, info);
 }
 }  // namespace tgfx
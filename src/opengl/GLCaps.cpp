@@ -243,6 +243,7 @@ void GLCaps::initGLSupport(const GLInfo& info) {
   vertexArrayObjectSupport = version >= GL_VER(3, 0) ||
                              info.hasExtension("GL_ARB_vertex_array_object") ||
                              info.hasExtension("GL_APPLE_vertex_array_object");
+  samplerObjectSupport = version >= GL_VER(3, 3) || info.hasExtension("GL_ARB_sampler_objects");
   textureRedSupport = version >= GL_VER(3, 0) || info.hasExtension("GL_ARB_texture_rg");
   multisampleDisableSupport = true;
   if (vendor != GLVendor::Intel) {
@@ -261,6 +262,7 @@ void GLCaps::initGLESSupport(const GLInfo& info) {
   unpackRowLengthSupport = version >= GL_VER(3, 0) || info.hasExtension("GL_EXT_unpack_subimage");
   vertexArrayObjectSupport =
       version >= GL_VER(3, 0) || info.hasExtension("GL_OES_vertex_array_object");
+  samplerObjectSupport = version >= GL_VER(3, 0);
   textureRedSupport = version >= GL_VER(3, 0) || info.hasExtension("GL_EXT_texture_rg");
   multisampleDisableSupport = info.hasExtension("GL_EXT_multisample_compatibility");
   textureBarrierSupport = info.hasExtension("GL_NV_texture_barrier");
@@ -299,6 +301,7 @@ void GLCaps::initWebGLSupport(const GLInfo& info) {
   vertexArrayObjectSupport = version >= GL_VER(2, 0) ||
                              info.hasExtension("GL_OES_vertex_array_object") ||
                              info.hasExtension("OES_vertex_array_object");
+  samplerObjectSupport = version >= GL_VER(2, 0);
   textureRedSupport = false;
   multisampleDisableSupport = false;  // no WebGL support
   textureBarrierSupport = false;
@@ -113,6 +113,7 @@ class GLCaps : public Caps {
   uint32_t version = 0;
   GLVendor vendor = GLVendor::Other;
   bool vertexArrayObjectSupport = false;
+  bool samplerObjectSupport = false;
   bool packRowLengthSupport = false;
   bool unpackRowLengthSupport = false;
   bool textureRedSupport = false;
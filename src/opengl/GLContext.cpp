@@ -18,12 +18,18 @@
 
 #include "opengl/GLContext.h"
 #include "GLGpu.h"
+#include "gpu/ShareGroup.h"
 #include "tgfx/opengl/GLDevice.h"
 
 namespace tgfx {
-GLContext::GLContext(Device* device, const GLInterface* glInterface)
+GLContext::GLContext(Device* device, const GLInterface* glInterface,
+                     std::shared_ptr<ShareGroup> shareGroup)
     : Context(device), glInterface(glInterface) {
   _gpu = GLGpu::Make(this).release();
+  _shareGroup = std::move(shareGroup);
+  if (_shareGroup != nullptr) {
+    _shareGroup->addContext();
+  }
 }
 
 void GLContext::resetState() {
@@ -32,7 +32,8 @@ class GLContext : public Context {
     return static_cast<GLContext*>(context);
   }
 
-  GLContext(Device* device, const GLInterface* glInterface);
+  GLContext(Device* device, const GLInterface* glInterface,
+            std::shared_ptr<ShareGroup> shareGroup = nullptr);
 
   Backend backend() const override {
     return Backend::OPENGL;
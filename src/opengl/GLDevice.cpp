@@ -18,6 +18,7 @@
 
 #include "tgfx/opengl/GLDevice.h"
 #include <thread>
+#include "gpu/ShareGroup.h"
 #include "opengl/GLContext.h"
 
 namespace tgfx {
@@ -59,7 +60,7 @@ std::shared_ptr<GLDevice> GLDevice::Get(void* nativeHandle) {
   return nullptr;
 }
 
-GLDevice::GLDevice(void* nativeHandle) : nativeHandle(nativeHandle) {
+GLDevice::GLDevice(void* nativeHandle) : nativeHandle(nativeHandle), shareRoot(nativeHandle) {
   std::lock_guard<std::mutex> autoLock(deviceMapLocker);
   deviceMap[nativeHandle] = this;
 }
@@ -76,7 +77,11 @@ bool GLDevice::onLockContext() {
   if (context == nullptr) {
     auto glInterface = GLInterface::GetNative();
     if (glInterface != nullptr) {
-      context = new GLContext(this, glInterface);
+      std::lock_guard<std::mutex> autoLock(deviceMapLocker);
+      if (shareGroup == nullptr) {
+        shareGroup = findShareGroup();
+      }
+      context = new GLContext(this, glInterface, shareGroup);
     } else {
       LOGE("GLDevice::onLockContext(): Error on creating GLInterface! ");
     }
@@ -88,6 +93,18 @@ bool GLDevice::onLockContext() {
   return true;
 }
 
+std::shared_ptr<ShareGroup> GLDevice::findShareGroup() const {
+  // Matches on the share root instead of calling sharableWith(), which is not symmetric on every
+  // platform, so that the group a device joins does not depend on which device locks first.
+  for (auto& item : deviceMap) {
+    auto device = item.second;
+    if (device != this && device->shareGroup != nullptr && device->shareRoot == shareRoot) {
+      return device->shareGroup;
+    }
+  }
+  return ShareGroup::Make();
+}
+
 void GLDevice::onUnlockContext() {
   onClearCurrent();
 }
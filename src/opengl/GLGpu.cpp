@@ -125,56 +125,6 @@ void GLGpu::writePixels(const TextureSampler* sampler, Rect rect, const void* pi
   }
 }
 
-static int FilterToGLMagFilter(FilterMode filterMode) {
-  switch (filterMode) {
-    case FilterMode::Nearest:
-      return GL_NEAREST;
-    case FilterMode::Linear:
-      return GL_LINEAR;
-  }
-}
-
-static int FilterToGLMinFilter(FilterMode filterMode, MipmapMode mipmapMode) {
-  switch (mipmapMode) {
-    case MipmapMode::None:
-      return FilterToGLMagFilter(filterMode);
-    case MipmapMode::Nearest:
-      switch (filterMode) {
-        case FilterMode::Nearest:
-          return GL_NEAREST_MIPMAP_NEAREST;
-        case FilterMode::Linear:
-          return GL_LINEAR_MIPMAP_NEAREST;
-      }
-    case MipmapMode::Linear:
-      switch (filterMode) {
-        case FilterMode::Nearest:
-          return GL_NEAREST_MIPMAP_LINEAR;
-        case FilterMode::Linear:
-          return GL_LINEAR_MIPMAP_LINEAR;
-      }
-  }
-}
-
-static int GetGLWrap(unsigned target, SamplerState::WrapMode wrapMode) {
-  if (target == GL_TEXTURE_RECTANGLE) {
-    if (wrapMode == SamplerState::WrapMode::ClampToBorder) {
-      return GL_CLAMP_TO_BORDER;
-    } else {
-      return GL_CLAMP_TO_EDGE;
-    }
-  }
-  switch (wrapMode) {
-    case SamplerState::WrapMode::Clamp:
-      return GL_CLAMP_TO_EDGE;
-    case SamplerState::WrapMode::Repeat:
-      return GL_REPEAT;
-    case SamplerState::WrapMode::MirrorRepeat:
-      return GL_MIRRORED_REPEAT;
-    case SamplerState::WrapMode::ClampToBorder:
-      return GL_CLAMP_TO_BORDER;
-  }
-}
-
 void GLGpu::bindTexture(int unitIndex, const TextureSampler* sampler, SamplerState samplerState) {
   if (sampler == nullptr) {
     return;
@@ -183,19 +133,71 @@ void GLGpu::bindTexture(int unitIndex, const TextureSampler* sampler, SamplerSta
   auto gl = GLFunctions::Get(context);
   gl->activeTexture(static_cast<unsigned>(GL_TEXTURE0 + unitIndex));
   gl->bindTexture(glSampler->target, glSampler->id);
+  if (samplerState.mipmapped() && (!context->caps()->mipmapSupport || !glSampler->hasMipmaps())) {
+    samplerState.mipmapMode = MipmapMode::None;
+  }
+  // Sampler objects can't express the wrap restrictions of rectangle and external textures, so
+  // only regular 2D textures use them.
+  if (glSampler->target == GL_TEXTURE_2D) {
+    auto samplerObject = findOrCreateSamplerObject(samplerState);
+    if (samplerObject != nullptr) {
+      bindSamplerObject(unitIndex, samplerObject->id());
+      return;
+    }
+  }
+  bindSamplerObject(unitIndex, 0);
   gl->texParameteri(glSampler->target, GL_TEXTURE_WRAP_S,
                     GetGLWrap(glSampler->target, samplerState.wrapModeX));
   gl->texParameteri(glSampler->target, GL_TEXTURE_WRAP_T,
                     GetGLWrap(glSampler->target, samplerState.wrapModeY));
-  if (samplerState.mipmapped() && (!context->caps()->mipmapSupport || !glSampler->hasMipmaps())) {
-    samplerState.mipmapMode = MipmapMode::None;
-  }
   gl->texParameteri(glSampler->target, GL_TEXTURE_MIN_FILTER,
                     FilterToGLMinFilter(samplerState.filterMode, samplerState.mipmapMode));
   gl->texParameteri(glSampler->target, GL_TEXTURE_MAG_FILTER,
                     FilterToGLMagFilter(samplerState.filterMode));
 }
 
+void GLGpu::unbindSamplerObjects() {
+  auto gl = GLFunctions::Get(context);
+  for (size_t unit = 0; unit < boundSamplerObjects.size(); unit++) {
+    if (boundSamplerObjects[unit] != 0) {
+      gl->bindSampler(static_cast<unsigned>(unit), 0);
+    }
+  }
+  boundSamplerObjects.clear();
+}
+
+std::shared_ptr<GLSamplerObject> GLGpu::findOrCreateSamplerObject(const SamplerState& state) {
+  auto key = GLSamplerObject::ComputeKey(state);
+  auto result = samplerObjects.find(key);
+  // The id becomes zero once the context has released all of its GPU resources.
+  if (result != samplerObjects.end() && result->second->id() != 0) {
+    return result->second;
+  }
+  auto samplerObject = GLSamplerObject::Make(context, state);
+  if (samplerObject != nullptr) {
+    samplerObjects[key] = samplerObject;
+  }
+  return samplerObject;
+}
+
+void GLGpu::bindSamplerObject(int unitIndex, unsigned samplerID) {
+  if (!GLCaps::Get(context)->samplerObjectSupport) {
+    return;
+  }
+  auto unit = static_cast<size_t>(unitIndex);
+  if (unit >= boundSamplerObjects.size()) {
+    if (samplerID == 0) {
+      return;
+    }
+    boundSamplerObjects.resize(unit + 1, 0);
+  }
+  if (boundSamplerObjects[unit] == samplerID) {
+    return;
+  }
+  GLFunctions::Get(context)->bindSampler(static_cast<unsigned>(unitIndex), samplerID);
+  boundSamplerObjects[unit] = samplerID;
+}
+
 void GLGpu::copyRenderTargetToTexture(const RenderTarget* renderTarget, Texture* texture,
                                       const Rect& srcRect, const Point& dstPoint) {
   auto gl = GLFunctions::Get(context);
@@ -264,10 +266,18 @@ bool GLGpu::waitSemaphore(const Semaphore* semaphore) {
   }
   auto gl = GLFunctions::Get(context);
   gl->waitSync(glSync, 0, GL_TIMEOUT_IGNORED);
-  gl->deleteSync(glSync);
   return true;
 }
 
+void GLGpu::deleteSemaphore(Semaphore* semaphore) {
+  auto glSemaphore = static_cast<GLSemaphore*>(semaphore);
+  if (glSemaphore == nullptr || glSemaphore->glSync == nullptr) {
+    return;
+  }
+  GLFunctions::Get(context)->deleteSync(glSemaphore->glSync);
+  glSemaphore->glSync = nullptr;
+}
+
 bool GLGpu::submitToGpu(bool syncCpu) {
   auto gl = GLFunctions::Get(context);
   if (syncCpu) {
@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include <unordered_map>
 #include "gpu/Gpu.h"
 #include "opengl/GLRenderPass.h"
+#include "opengl/GLSamplerObject.h"
 
 namespace tgfx {
 class GLGpu : public Gpu {
@@ -36,8 +38,19 @@ class GLGpu : public Gpu {
   void writePixels(const TextureSampler* sampler, Rect rect, const void* pixels,
                    size_t rowBytes) override;
 
+  /**
+   * Binds the sampler to the specified texture unit. If sampler objects are supported, the
+   * SamplerState is applied through a cached sampler object instead of setting the texture
+   * parameters on every bind.
+   */
   void bindTexture(int unitIndex, const TextureSampler* sampler, SamplerState samplerState = {});
 
+  /**
+   * Unbinds all sampler objects bound by bindTexture(), restoring the texture parameters as the
+   * sampling state of each texture unit.
+   */
+  void unbindSamplerObjects();
+
   void copyRenderTargetToTexture(const RenderTarget* renderTarget, Texture* texture,
                                  const Rect& srcRect, const Point& dstPoint) override;
 
@@ -47,16 +60,24 @@ class GLGpu : public Gpu {
 
   bool waitSemaphore(const Semaphore* semaphore) override;
 
+  void deleteSemaphore(Semaphore* semaphore) override;
+
   bool submitToGpu(bool syncCpu) override;
 
   void submit(RenderPass* renderPass) override;
 
  private:
   std::shared_ptr<RenderPass> renderPass = nullptr;
+  std::unordered_map<uint32_t, std::shared_ptr<GLSamplerObject>> samplerObjects = {};
+  std::vector<unsigned> boundSamplerObjects = {};
 
   explicit GLGpu(Context* context) : Gpu(context) {
   }
 
   void onRegenerateMipmapLevels(const TextureSampler* sampler) override;
+
+  std::shared_ptr<GLSamplerObject> findOrCreateSamplerObject(const SamplerState& state);
+
+  void bindSamplerObject(int unitIndex, unsigned samplerID);
 };
 }  // namespace tgfx
@@ -22,7 +22,7 @@
 #include "GLContext.h"
 #include "gpu/Program.h"
 #include "gpu/ProgramInfo.h"
-#include "gpu/SLType.h"
+#include "gpu/VertexFormat.h"
 #include "opengl/GLRenderTarget.h"
 #include "opengl/GLUniformHandler.h"
 
@@ -30,7 +30,7 @@ namespace tgfx {
 class GLProgram : public Program {
  public:
   struct Attribute {
-    SLType gpuType = SLType::Float;
+    VertexFormat format = VertexFormat::Float;
     size_t offset = 0;
     int location = 0;
   };
@@ -125,7 +125,7 @@ void GLProgramBuilder::computeCountsAndStrides(unsigned int programID) {
   vertexStride = 0;
   for (const auto* attr : pipeline->getGeometryProcessor()->vertexAttributes()) {
     GLProgram::Attribute attribute;
-    attribute.gpuType = attr->gpuType();
+    attribute.format = attr->format();
     attribute.offset = vertexStride;
     vertexStride += attr->sizeAlign4();
     attribute.location = gl->getAttribLocation(programID, attr->name().c_str());
@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "GLRenderPass.h"
+#include "GLGpu.h"
 #include "GLUtil.h"
 #include "gpu/DrawingManager.h"
 #include "gpu/ProgramCache.h"
@@ -25,18 +26,23 @@
 
 namespace tgfx {
 struct AttribLayout {
-  bool normalized = false;  // Only used by floating point types.
+  bool normalized = false;  // Only used by integer types that are read as floating point.
   int count = 0;
   unsigned type = 0;
 };
 
-static constexpr std::pair<SLType, AttribLayout> attribLayoutPair[] = {
-    {SLType::Float, {false, 1, GL_FLOAT}},  {SLType::Float2, {false, 2, GL_FLOAT}},
-    {SLType::Float3, {false, 3, GL_FLOAT}}, {SLType::Float4, {false, 4, GL_FLOAT}},
-    {SLType::Int, {false, 1, GL_INT}},      {SLType::Int2, {false, 2, GL_INT}},
-    {SLType::Int3, {false, 3, GL_INT}},     {SLType::Int4, {false, 4, GL_INT}}};
+static constexpr std::pair<VertexFormat, AttribLayout> attribLayoutPair[] = {
+    {VertexFormat::Float, {false, 1, GL_FLOAT}},
+    {VertexFormat::Float2, {false, 2, GL_FLOAT}},
+    {VertexFormat::Float3, {false, 3, GL_FLOAT}},
+    {VertexFormat::Float4, {false, 4, GL_FLOAT}},
+    {VertexFormat::Int, {false, 1, GL_INT}},
+    {VertexFormat::Int2, {false, 2, GL_INT}},
+    {VertexFormat::Int3, {false, 3, GL_INT}},
+    {VertexFormat::Int4, {false, 4, GL_INT}},
+    {VertexFormat::UByte4Normalized, {true, 4, GL_UNSIGNED_BYTE}}};
 
-static AttribLayout GetAttribLayout(SLType type) {
+static AttribLayout GetAttribLayout(VertexFormat type) {
   for (const auto& pair : attribLayoutPair) {
     if (pair.first == type) {
       return pair.second;
@@ -149,7 +155,7 @@ void GLRenderPass::draw(const std::function<void()>& func) {
   gl->bindBuffer(GL_ARRAY_BUFFER, std::static_pointer_cast<GLBuffer>(_vertexBuffer)->bufferID());
   auto* program = static_cast<GLProgram*>(_program);
   for (const auto& attribute : program->vertexAttributes()) {
-    const AttribLayout& layout = GetAttribLayout(attribute.gpuType);
+    const AttribLayout& layout = GetAttribLayout(attribute.format);
     gl->vertexAttribPointer(static_cast<unsigned>(attribute.location), layout.count, layout.type,
                             layout.normalized, program->vertexStride(),
                             reinterpret_cast<void*>(attribute.offset));
@@ -172,4 +178,10 @@ void GLRenderPass::onClear(const Rect& scissor, Color color) {
   gl->clearColor(color.red, color.green, color.blue, color.alpha);
   gl->clear(GL_COLOR_BUFFER_BIT);
 }
+
+void GLRenderPass::onEnd() {
+  // Sampler objects override the parameters of any texture bound to the same unit, so they must
+  // not leak into later texture uploads or the host application's rendering.
+  static_cast<GLGpu*>(context->gpu())->unbindSamplerObjects();
+}
 }  // namespace tgfx
@@ -42,6 +42,7 @@ class GLRenderPass : public RenderPass {
   void onDraw(PrimitiveType primitiveType, size_t baseVertex, size_t vertexCount) override;
   void onDrawIndexed(PrimitiveType primitiveType, size_t baseIndex, size_t indexCount) override;
   void onClear(const Rect& scissor, Color color) override;
+  void onEnd() override;
 
  private:
   ResourceHandle vertexArrayHandle = {};
@@ -0,0 +1,54 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "GLSamplerObject.h"
+#include "GLUtil.h"
+
+namespace tgfx {
+std::shared_ptr<GLSamplerObject> GLSamplerObject::Make(Context* context,
+                                                       const SamplerState& state) {
+  if (!GLCaps::Get(context)->samplerObjectSupport) {
+    return nullptr;
+  }
+  auto gl = GLFunctions::Get(context);
+  unsigned id = 0;
+  gl->genSamplers(1, &id);
+  if (id == 0) {
+    return nullptr;
+  }
+  gl->samplerParameteri(id, GL_TEXTURE_WRAP_S, GetGLWrap(GL_TEXTURE_2D, state.wrapModeX));
+  gl->samplerParameteri(id, GL_TEXTURE_WRAP_T, GetGLWrap(GL_TEXTURE_2D, state.wrapModeY));
+  gl->samplerParameteri(id, GL_TEXTURE_MIN_FILTER,
+                        FilterToGLMinFilter(state.filterMode, state.mipmapMode));
+  gl->samplerParameteri(id, GL_TEXTURE_MAG_FILTER, FilterToGLMagFilter(state.filterMode));
+  return Resource::AddToCache(context, new GLSamplerObject(id));
+}
+
+uint32_t GLSamplerObject::ComputeKey(const SamplerState& state) {
+  return static_cast<uint32_t>(state.wrapModeX) | static_cast<uint32_t>(state.wrapModeY) << 4 |
+         static_cast<uint32_t>(state.filterMode) << 8 |
+         static_cast<uint32_t>(state.mipmapMode) << 12;
+}
+
+void GLSamplerObject::onReleaseGPU() {
+  if (_id > 0) {
+    GLFunctions::Get(context)->deleteSamplers(1, &_id);
+    _id = 0;
+  }
+}
+}  // namespace tgfx
@@ -0,0 +1,60 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "gpu/Resource.h"
+#include "gpu/SamplerState.h"
+
+namespace tgfx {
+/**
+ * GLSamplerObject wraps an OpenGL sampler object that stores the wrap and filter parameters of a
+ * SamplerState. Binding it to a texture unit overrides the sampling parameters of the texture
+ * bound to that unit, so the parameters don't have to be uploaded again for every draw.
+ */
+class GLSamplerObject : public Resource {
+ public:
+  /**
+   * Creates a new GLSamplerObject configured with the specified SamplerState. Returns nullptr if
+   * sampler objects are not supported by the current context.
+   */
+  static std::shared_ptr<GLSamplerObject> Make(Context* context, const SamplerState& state);
+
+  /**
+   * Packs the fields of the SamplerState into a key that identifies the GLSamplerObject.
+   */
+  static uint32_t ComputeKey(const SamplerState& state);
+
+  size_t memoryUsage() const override {
+    return 0;
+  }
+
+  unsigned id() const {
+    return _id;
+  }
+
+ protected:
+  void onReleaseGPU() override;
+
+ private:
+  unsigned _id = 0;
+
+  explicit GLSamplerObject(unsigned id) : _id(id) {
+  }
+};
+}  // namespace tgfx
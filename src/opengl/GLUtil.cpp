@@ -154,4 +154,54 @@ bool CheckGLErrorImpl(Context* context, std::string file, int line) {
   return success;
 #endif
 }
+
+int FilterToGLMagFilter(FilterMode filterMode) {
+  switch (filterMode) {
+    case FilterMode::Nearest:
+      return GL_NEAREST;
+    case FilterMode::Linear:
+      return GL_LINEAR;
+  }
+}
+
+int FilterToGLMinFilter(FilterMode filterMode, MipmapMode mipmapMode) {
+  switch (mipmapMode) {
+    case MipmapMode::None:
+      return FilterToGLMagFilter(filterMode);
+    case MipmapMode::Nearest:
+      switch (filterMode) {
+        case FilterMode::Nearest:
+          return GL_NEAREST_MIPMAP_NEAREST;
+        case FilterMode::Linear:
+          return GL_LINEAR_MIPMAP_NEAREST;
+      }
+    case MipmapMode::Linear:
+      switch (filterMode) {
+        case FilterMode::Nearest:
+          return GL_NEAREST_MIPMAP_LINEAR;
+        case FilterMode::Linear:
+          return GL_LINEAR_MIPMAP_LINEAR;
+      }
+  }
+}
+
+int GetGLWrap(unsigned target, SamplerState::WrapMode wrapMode) {
+  if (target == GL_TEXTURE_RECTANGLE) {
+    if (wrapMode == SamplerState::WrapMode::ClampToBorder) {
+      return GL_CLAMP_TO_BORDER;
+    } else {
+      return GL_CLAMP_TO_EDGE;
+    }
+  }
+  switch (wrapMode) {
+    case SamplerState::WrapMode::Clamp:
+      return GL_CLAMP_TO_EDGE;
+    case SamplerState::WrapMode::Repeat:
+      return GL_REPEAT;
+    case SamplerState::WrapMode::MirrorRepeat:
+      return GL_MIRRORED_REPEAT;
+    case SamplerState::WrapMode::ClampToBorder:
+      return GL_CLAMP_TO_BORDER;
+  }
+}
 }  // namespace tgfx
@@ -20,6 +20,7 @@
 
 #include <array>
 #include <string>
+#include "gpu/SamplerState.h"
 #include "opengl/GLContext.h"
 #include "opengl/GLSampler.h"
 #include "tgfx/core/Matrix.h"
@@ -46,6 +47,12 @@ unsigned CreateGLProgram(Context* context, const std::string& vertex, const std:
 
 unsigned LoadGLShader(Context* context, unsigned shaderType, const std::string& source);
 
+int FilterToGLMagFilter(FilterMode filterMode);
+
+int FilterToGLMinFilter(FilterMode filterMode, MipmapMode mipmapMode);
+
+int GetGLWrap(unsigned target, SamplerState::WrapMode wrapMode);
+
 bool CheckGLErrorImpl(Context* context, std::string file, int line);
 
 #ifdef DEBUG
@@ -86,6 +86,7 @@ std::shared_ptr<CGLDevice> CGLDevice::Wrap(CGLContextObj cglContext, bool extern
 
 CGLDevice::CGLDevice(CGLContextObj cglContext) : GLDevice(cglContext) {
   glContext = [[NSOpenGLContext alloc] initWithCGLContextObj:cglContext];
+  shareRoot = CGLGetShareGroup(cglContext);
 }
 
 CGLDevice::~CGLDevice() {
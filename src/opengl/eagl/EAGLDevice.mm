@@ -128,6 +128,7 @@ void EAGLDevice::NotifyReferenceReachedZero(EAGLDevice* device) {
 EAGLDevice::EAGLDevice(EAGLContext* eaglContext)
     : GLDevice(eaglContext), _eaglContext(eaglContext) {
   [_eaglContext retain];
+  shareRoot = (__bridge void*)[_eaglContext sharegroup];
   std::lock_guard<std::mutex> autoLock(deviceLocker);
   auto index = deviceList.size();
   deviceList.push_back(this);
@@ -132,6 +132,11 @@ std::shared_ptr<EGLDevice> EGLDevice::Wrap(EGLDisplay eglDisplay, EGLSurface egl
   device->eglSurface = eglSurface;
   device->eglContext = eglContext;
   device->shareContext = shareContext;
+  if (shareContext != nullptr) {
+    // Contexts created from a shared one all belong to the share group of its root context.
+    auto shareDevice = std::static_pointer_cast<EGLDevice>(GLDevice::Get(shareContext));
+    device->shareRoot = shareDevice != nullptr ? shareDevice->shareRoot : shareContext;
+  }
   device->weakThis = device;
   if (oldEglContext != eglContext) {
     eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
@@ -162,14 +167,15 @@ bool EGLDevice::sharableWith(void* nativeContext) const {
 
 bool EGLDevice::onMakeCurrent() {
   oldEglContext = eglGetCurrentContext();
-  oldEglDisplay = eglGetCurrentDisplay();
-  oldEglReadSurface = eglGetCurrentSurface(EGL_READ);
-  oldEglDrawSurface = eglGetCurrentSurface(EGL_DRAW);
   if (oldEglContext == eglContext) {
     // If the current context is already set by external, we don't need to switch it again.
     // The read/draw surface may be different.
     return true;
   }
+  // The rest of the current state is only needed to restore it in onClearCurrent().
+  oldEglDisplay = eglGetCurrentDisplay();
+  oldEglReadSurface = eglGetCurrentSurface(EGL_READ);
+  oldEglDrawSurface = eglGetCurrentSurface(EGL_DRAW);
   auto result = eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext);
   if (!result) {
     LOGE("EGLDevice::onMakeCurrent() failure result = %d error= %d", result, eglGetError());
@@ -23,6 +23,9 @@
 #include "EGLHardwareTexture.h"
 #include "platform/android/AHardwareBufferFunctions.h"
 #include "tgfx/platform/HardwareBuffer.h"
+#elif defined(__linux__)
+#include "EGLHardwareTexture.h"
+#include "platform/linux/LinuxHardwareBuffer.h"
 #endif
 
 namespace tgfx {
@@ -48,6 +51,23 @@ std::shared_ptr<Texture> Texture::MakeFrom(Context* context, HardwareBufferRef h
   return EGLHardwareTexture::MakeFrom(context, hardwareBuffer);
 }
 
+#elif defined(__linux__)
+
+bool HardwareBufferAvailable() {
+  // Buffers are only handed to the GPU without copying if they can be exported as dma-bufs.
+  static const bool available =
+      LinuxHardwareBuffer::DmaBufAvailable() && EGLHardwareTexture::IsSupported();
+  return available;
+}
+
+std::shared_ptr<Texture> Texture::MakeFrom(Context* context, HardwareBufferRef hardwareBuffer,
+                                           YUVColorSpace) {
+  if (!HardwareBufferCheck(hardwareBuffer)) {
+    return nullptr;
+  }
+  return EGLHardwareTexture::MakeFrom(context, hardwareBuffer);
+}
+
 #else
 
 bool HardwareBufferAvailable() {
@@ -16,12 +16,17 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-#if defined(__ANDROID__) || defined(ANDROID)
+#if defined(__ANDROID__) || defined(ANDROID) || defined(__linux__)
 
 #include "EGLHardwareTexture.h"
 #include <GLES/gl.h>
 #include <GLES/glext.h>
+#if defined(__ANDROID__) || defined(ANDROID)
 #include <android/hardware_buffer.h>
+#else
+#include "opengl/egl/EGLUtil.h"
+#include "platform/linux/LinuxHardwareBuffer.h"
+#endif
 #include "gpu/Gpu.h"
 #include "opengl/GLSampler.h"
 #include "tgfx/core/Pixmap.h"
@@ -31,27 +36,82 @@
 
 namespace tgfx {
 namespace eglext {
+#if defined(__ANDROID__) || defined(ANDROID)
 static PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC eglGetNativeClientBufferANDROID = nullptr;
+#endif
 static PFNGLEGLIMAGETARGETTEXTURE2DOESPROC glEGLImageTargetTexture2DOES = nullptr;
 static PFNEGLCREATEIMAGEKHRPROC eglCreateImageKHR = nullptr;
 static PFNEGLDESTROYIMAGEKHRPROC eglDestroyImageKHR = nullptr;
 }  // namespace eglext
 
 static bool InitEGLEXTProc() {
-  eglext::eglGetNativeClientBufferANDROID =
-      (PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC)eglGetProcAddress("eglGetNativeClientBufferANDROID");
   eglext::glEGLImageTargetTexture2DOES =
       (PFNGLEGLIMAGETARGETTEXTURE2DOESPROC)eglGetProcAddress("glEGLImageTargetTexture2DOES");
   eglext::eglCreateImageKHR = (PFNEGLCREATEIMAGEKHRPROC)eglGetProcAddress("eglCreateImageKHR");
   eglext::eglDestroyImageKHR = (PFNEGLDESTROYIMAGEKHRPROC)eglGetProcAddress("eglDestroyImageKHR");
-  return eglext::eglGetNativeClientBufferANDROID && eglext::glEGLImageTargetTexture2DOES &&
-         eglext::eglCreateImageKHR && eglext::eglDestroyImageKHR;
+#if defined(__ANDROID__) || defined(ANDROID)
+  eglext::eglGetNativeClientBufferANDROID =
+      (PFNEGLGETNATIVECLIENTBUFFERANDROIDPROC)eglGetProcAddress("eglGetNativeClientBufferANDROID");
+  if (!eglext::eglGetNativeClientBufferANDROID) {
+    return false;
+  }
+#endif
+  return eglext::glEGLImageTargetTexture2DOES && eglext::eglCreateImageKHR &&
+         eglext::eglDestroyImageKHR;
 }
 
-std::shared_ptr<EGLHardwareTexture> EGLHardwareTexture::MakeFrom(Context* context,
-                                                                 AHardwareBuffer* hardwareBuffer) {
+#if defined(__ANDROID__) || defined(ANDROID)
+
+static EGLImageKHR CreateEGLImage(EGLDisplay display, HardwareBufferRef hardwareBuffer,
+                                  const ImageInfo&) {
+  EGLClientBuffer clientBuffer = eglext::eglGetNativeClientBufferANDROID(hardwareBuffer);
+  if (!clientBuffer) {
+    return EGL_NO_IMAGE_KHR;
+  }
+  EGLint attributes[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE};
+  return eglext::eglCreateImageKHR(display, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID,
+                                   clientBuffer, attributes);
+}
+
+#else
+
+// DRM_FORMAT_ABGR8888 from drm_fourcc.h, which stores the R, G, B, A bytes in memory order.
+static constexpr EGLint DRM_FORMAT_RGBA_8888 = 'A' | ('B' << 8) | ('2' << 16) | ('4' << 24);
+
+static EGLImageKHR CreateEGLImage(EGLDisplay display, HardwareBufferRef hardwareBuffer,
+                                  const ImageInfo& info) {
+  auto linuxBuffer = LinuxHardwareBuffer::Cast(hardwareBuffer);
+  if (linuxBuffer == nullptr || linuxBuffer->dmaBufFD() < 0 ||
+      info.colorType() != ColorType::RGBA_8888 || !GetEGLExtensions(display).dmaBufImport) {
+    return EGL_NO_IMAGE_KHR;
+  }
+  EGLint attributes[] = {EGL_WIDTH,
+                         info.width(),
+                         EGL_HEIGHT,
+                         info.height(),
+                         EGL_LINUX_DRM_FOURCC_EXT,
+                         DRM_FORMAT_RGBA_8888,
+                         EGL_DMA_BUF_PLANE0_FD_EXT,
+                         linuxBuffer->dmaBufFD(),
+                         EGL_DMA_BUF_PLANE0_OFFSET_EXT,
+                         0,
+                         EGL_DMA_BUF_PLANE0_PITCH_EXT,
+                         static_cast<EGLint>(info.rowBytes()),
+                         EGL_NONE};
+  return eglext::eglCreateImageKHR(display, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT, nullptr,
+                                   attributes);
+}
+
+#endif
+
+bool EGLHardwareTexture::IsSupported() {
   static const bool initialized = InitEGLEXTProc();
-  if (!initialized) {
+  return initialized;
+}
+
+std::shared_ptr<EGLHardwareTexture> EGLHardwareTexture::MakeFrom(Context* context,
+                                                                 HardwareBufferRef hardwareBuffer) {
+  if (!IsSupported()) {
     return nullptr;
   }
   auto info = HardwareBufferGetInfo(hardwareBuffer);
@@ -63,14 +123,8 @@ std::shared_ptr<EGLHardwareTexture> EGLHardwareTexture::MakeFrom(Context* contex
   if (glTexture != nullptr) {
     return glTexture;
   }
-  EGLClientBuffer clientBuffer = eglext::eglGetNativeClientBufferANDROID(hardwareBuffer);
-  if (!clientBuffer) {
-    return nullptr;
-  }
   auto display = static_cast<EGLDevice*>(context->device())->getDisplay();
-  EGLint attributes[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE};
-  EGLImageKHR eglImage = eglext::eglCreateImageKHR(
-      display, EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID, clientBuffer, attributes);
+  auto eglImage = CreateEGLImage(display, hardwareBuffer, info);
   if (eglImage == EGL_NO_IMAGE_KHR) {
     return nullptr;
   }
@@ -96,7 +150,7 @@ std::shared_ptr<EGLHardwareTexture> EGLHardwareTexture::MakeFrom(Context* contex
   return glTexture;
 }
 
-EGLHardwareTexture::EGLHardwareTexture(AHardwareBuffer* hardwareBuffer, EGLImageKHR eglImage,
+EGLHardwareTexture::EGLHardwareTexture(HardwareBufferRef hardwareBuffer, EGLImageKHR eglImage,
                                        int width, int height)
     : Texture(width, height, ImageOrigin::TopLeft),
       hardwareBuffer(HardwareBufferRetain(hardwareBuffer)), eglImage(eglImage) {
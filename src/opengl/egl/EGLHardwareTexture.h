@@ -16,7 +16,7 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-#if defined(__ANDROID__) || defined(ANDROID)
+#if defined(__ANDROID__) || defined(ANDROID) || defined(__linux__)
 
 #pragma once
 
@@ -28,8 +28,13 @@
 namespace tgfx {
 class EGLHardwareTexture : public Texture {
  public:
+  /**
+   * Returns true if the EGL functions needed to import hardware buffers are available.
+   */
+  static bool IsSupported();
+
   static std::shared_ptr<EGLHardwareTexture> MakeFrom(Context* context,
-                                                      AHardwareBuffer* hardwareBuffer);
+                                                      HardwareBufferRef hardwareBuffer);
 
   size_t memoryUsage() const override;
 
@@ -46,12 +51,13 @@ class EGLHardwareTexture : public Texture {
 
  private:
   std::unique_ptr<TextureSampler> sampler = {};
-  AHardwareBuffer* hardwareBuffer = nullptr;
+  HardwareBufferRef hardwareBuffer = nullptr;
   EGLImageKHR eglImage = EGL_NO_IMAGE_KHR;
 
   static ScratchKey ComputeScratchKey(void* hardwareBuffer);
 
-  EGLHardwareTexture(AHardwareBuffer* hardwareBuffer, EGLImageKHR eglImage, int width, int height);
+  EGLHardwareTexture(HardwareBufferRef hardwareBuffer, EGLImageKHR eglImage, int width,
+                     int height);
 
   ~EGLHardwareTexture() override;
 };
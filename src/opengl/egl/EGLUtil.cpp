@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "EGLUtil.h"
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace tgfx {
+bool HasEGLExtension(EGLDisplay eglDisplay, const char* name) {
+  auto extensions = eglQueryString(eglDisplay, EGL_EXTENSIONS);
+  if (extensions == nullptr) {
+    return false;
+  }
+  auto length = strlen(name);
+  auto position = extensions;
+  while ((position = strstr(position, name)) != nullptr) {
+    auto end = position[length];
+    if ((position == extensions || position[-1] == ' ') && (end == ' ' || end == '\0')) {
+      return true;
+    }
+    position += length;
+  }
+  return false;
+}
+
+static EGLExtensions QueryEGLExtensions(EGLDisplay eglDisplay) {
+  EGLExtensions extensions = {};
+  extensions.bufferAge = HasEGLExtension(eglDisplay, "EGL_EXT_buffer_age");
+  extensions.dmaBufImport = HasEGLExtension(eglDisplay, "EGL_EXT_image_dma_buf_import");
+  if (HasEGLExtension(eglDisplay, "EGL_KHR_swap_buffers_with_damage")) {
+    extensions.eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+        eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+  }
+  if (HasEGLExtension(eglDisplay, "EGL_KHR_partial_update")) {
+    extensions.eglSetDamageRegion = reinterpret_cast<PFNEGLSETDAMAGEREGIONKHRPROC>(
+        eglGetProcAddress("eglSetDamageRegionKHR"));
+  }
+  return extensions;
+}
+
+const EGLExtensions& GetEGLExtensions(EGLDisplay eglDisplay) {
+  static std::mutex locker = {};
+  static std::unordered_map<EGLDisplay, EGLExtensions> extensionsMap = {};
+  std::lock_guard<std::mutex> autoLock(locker);
+  auto result = extensionsMap.find(eglDisplay);
+  if (result != extensionsMap.end()) {
+    return result->second;
+  }
+  // Elements of an unordered_map keep their addresses when others are inserted.
+  return extensionsMap[eglDisplay] = QueryEGLExtensions(eglDisplay);
+}
+}  // namespace tgfx
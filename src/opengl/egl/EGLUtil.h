@@ -0,0 +1,46 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace tgfx {
+/**
+ * Returns true if the extension string of the display contains the given extension name as a
+ * whole token.
+ */
+bool HasEGLExtension(EGLDisplay eglDisplay, const char* name);
+
+/**
+ * The optional EGL extensions used by tgfx, as supported by one display.
+ */
+struct EGLExtensions {
+  bool bufferAge = false;
+  bool dmaBufImport = false;
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC eglSwapBuffersWithDamage = nullptr;
+  PFNEGLSETDAMAGEREGIONKHRPROC eglSetDamageRegion = nullptr;
+};
+
+/**
+ * Returns the optional extensions supported by the display. They are queried on the first call for
+ * each display and cached afterward, since different displays may support different extensions.
+ */
+const EGLExtensions& GetEGLExtensions(EGLDisplay eglDisplay);
+}  // namespace tgfx
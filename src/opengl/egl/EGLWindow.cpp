@@ -25,9 +25,21 @@
 #endif
 #include <EGL/eglext.h>
 #include <GLES3/gl3.h>
+#include "opengl/egl/EGLUtil.h"
 #include "utils/USE.h"
 
 namespace tgfx {
+/**
+ * Converts a rect with a top-left origin to the EGL rect layout {x, y, width, height}, which has a
+ * bottom-left origin.
+ */
+static void ToEGLRect(const Rect& rect, EGLint surfaceHeight, EGLint eglRect[4]) {
+  eglRect[0] = static_cast<EGLint>(rect.left);
+  eglRect[1] = surfaceHeight - static_cast<EGLint>(rect.bottom);
+  eglRect[2] = static_cast<EGLint>(rect.width());
+  eglRect[3] = static_cast<EGLint>(rect.height());
+}
+
 std::shared_ptr<EGLWindow> EGLWindow::Current() {
   auto device = std::static_pointer_cast<EGLDevice>(GLDevice::Current());
   if (device == nullptr || device->eglSurface == nullptr) {
@@ -100,6 +112,44 @@ void EGLWindow::onPresent(Context*, int64_t presentationTime) {
       eglPresentationTimeANDROID(eglDisplay, eglSurface, presentationTime * 1000);
     }
   }
+  if (!presentDamage.isEmpty() && surface != nullptr) {
+    auto eglSwapBuffersWithDamage = GetEGLExtensions(eglDisplay).eglSwapBuffersWithDamage;
+    if (eglSwapBuffersWithDamage) {
+      auto damage = presentDamage;
+      damage.roundOut();
+      EGLint rect[4] = {};
+      ToEGLRect(damage, surface->height(), rect);
+      if (eglSwapBuffersWithDamage(eglDisplay, eglSurface, rect, 1)) {
+        return;
+      }
+    }
+  }
   eglSwapBuffers(eglDisplay, eglSurface);
 }
+
+int EGLWindow::onQueryBufferAge() {
+  auto device = std::static_pointer_cast<EGLDevice>(this->device);
+  if (!GetEGLExtensions(device->eglDisplay).bufferAge) {
+    return 0;
+  }
+  EGLint age = 0;
+  if (!eglQuerySurface(device->eglDisplay, device->eglSurface, EGL_BUFFER_AGE_EXT, &age)) {
+    return 0;
+  }
+  return age;
+}
+
+void EGLWindow::onSetDamageRegion(const Rect& repaintRect) {
+  if (surface == nullptr) {
+    return;
+  }
+  auto device = std::static_pointer_cast<EGLDevice>(this->device);
+  auto eglSetDamageRegion = GetEGLExtensions(device->eglDisplay).eglSetDamageRegion;
+  if (eglSetDamageRegion == nullptr) {
+    return;
+  }
+  EGLint rect[4] = {};
+  ToEGLRect(repaintRect, surface->height(), rect);
+  eglSetDamageRegion(device->eglDisplay, device->eglSurface, rect, 1);
+}
 }  // namespace tgfx
\ No newline at end of file
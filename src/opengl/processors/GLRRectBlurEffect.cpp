@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "GLRRectBlurEffect.h"
+
+namespace tgfx {
+// The number of samples used to integrate the blur along the y-axis.
+static constexpr int SAMPLE_COUNT = 4;
+
+std::unique_ptr<RRectBlurEffect> RRectBlurEffect::Make(const Rect& rect, float cornerRadius,
+                                                       float sigma, const Matrix& matrix) {
+  if (rect.isEmpty() || sigma <= 0.0f) {
+    return nullptr;
+  }
+  return std::unique_ptr<RRectBlurEffect>(
+      new GLRRectBlurEffect(rect, cornerRadius, sigma, matrix));
+}
+
+GLRRectBlurEffect::GLRRectBlurEffect(const Rect& rect, float cornerRadius, float sigma,
+                                     const Matrix& matrix)
+    : RRectBlurEffect(rect, cornerRadius, sigma, matrix) {
+}
+
+void GLRRectBlurEffect::emitCode(EmitArgs& args) const {
+  auto* fragBuilder = args.fragBuilder;
+  auto* uniformHandler = args.uniformHandler;
+  auto rectName = uniformHandler->addUniform(ShaderFlags::Fragment, SLType::Float4, "Rect");
+  auto paramsName = uniformHandler->addUniform(ShaderFlags::Fragment, SLType::Float2, "Params");
+  fragBuilder->codeAppendf("vec2 halfSize = (%s.zw - %s.xy) * 0.5;", rectName.c_str(),
+                           rectName.c_str());
+  fragBuilder->codeAppendf("vec2 point = %s - (%s.xy + halfSize);",
+                           (*args.transformedCoords)[0].name().c_str(), rectName.c_str());
+  fragBuilder->codeAppendf("float sigma = %s.x;", paramsName.c_str());
+  fragBuilder->codeAppendf("float corner = %s.y;", paramsName.c_str());
+  // Only the part of the kernel that overlaps the rrect along y contributes to the coverage.
+  fragBuilder->codeAppend("float low = point.y - halfSize.y;");
+  fragBuilder->codeAppend("float high = point.y + halfSize.y;");
+  fragBuilder->codeAppend("float start = clamp(-3.0 * sigma, low, high);");
+  fragBuilder->codeAppend("float end = clamp(3.0 * sigma, low, high);");
+  fragBuilder->codeAppendf("float step = (end - start) / %d.0;", SAMPLE_COUNT);
+  fragBuilder->codeAppend("float y = start + step * 0.5;");
+  fragBuilder->codeAppend("float value = 0.0;");
+  fragBuilder->codeAppendf("for (int i = 0; i < %d; i++) {", SAMPLE_COUNT);
+  // The horizontal extent of the rrect on the row at distance y from the sample point.
+  fragBuilder->codeAppend("float delta = min(halfSize.y - corner - abs(point.y - y), 0.0);");
+  fragBuilder->codeAppend(
+      "float curved = halfSize.x - corner + sqrt(max(0.0, corner * corner - delta * delta));");
+  // Integrates the Gaussian across that row with an approximation of erf().
+  fragBuilder->codeAppend("vec2 x = (point.x + vec2(-curved, curved)) * (0.70710678 / sigma);");
+  fragBuilder->codeAppend("vec2 s = sign(x);");
+  fragBuilder->codeAppend("vec2 a = abs(x);");
+  fragBuilder->codeAppend("vec2 t = 1.0 + (0.278393 + (0.230389 + 0.078108 * (a * a)) * a) * a;");
+  fragBuilder->codeAppend("t *= t;");
+  fragBuilder->codeAppend("vec2 integral = 0.5 + 0.5 * (s - s / (t * t));");
+  fragBuilder->codeAppend(
+      "value += (integral.y - integral.x) * exp(-(y * y) / (2.0 * sigma * sigma)) * step;");
+  fragBuilder->codeAppend("y += step;");
+  fragBuilder->codeAppend("}");
+  fragBuilder->codeAppend("float coverage = value / (2.50662827 * sigma);");
+  fragBuilder->codeAppendf("%s = %s * coverage;", args.outputColor.c_str(),
+                           args.inputColor.c_str());
+}
+
+void GLRRectBlurEffect::onSetData(UniformBuffer* uniformBuffer) const {
+  uniformBuffer->setData("Rect", rect);
+  uniformBuffer->setData("Params", Point::Make(sigma, cornerRadius));
+}
+}  // namespace tgfx
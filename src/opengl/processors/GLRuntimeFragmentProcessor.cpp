@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "GLRuntimeFragmentProcessor.h"
+#include "gpu/Pipeline.h"
+
+namespace tgfx {
+std::unique_ptr<RuntimeFragmentProcessor> RuntimeFragmentProcessor::Make(
+    std::shared_ptr<RuntimeEffect> effect, std::vector<float> uniformValues,
+    std::vector<std::unique_ptr<FragmentProcessor>> children, const Matrix& matrix) {
+  if (effect == nullptr || uniformValues.size() != effect->uniformSize() ||
+      children.size() != effect->childCount()) {
+    return nullptr;
+  }
+  return std::unique_ptr<RuntimeFragmentProcessor>(new GLRuntimeFragmentProcessor(
+      std::move(effect), std::move(uniformValues), std::move(children), matrix));
+}
+
+GLRuntimeFragmentProcessor::GLRuntimeFragmentProcessor(
+    std::shared_ptr<RuntimeEffect> effect, std::vector<float> uniformValues,
+    std::vector<std::unique_ptr<FragmentProcessor>> children, const Matrix& matrix)
+    : RuntimeFragmentProcessor(std::move(effect), std::move(uniformValues), std::move(children),
+                               matrix) {
+}
+
+struct UniformInfo {
+  SLType type;
+  std::string typeName;
+  size_t floatCount;
+};
+
+static UniformInfo GetUniformInfo(RuntimeEffect::UniformType type) {
+  switch (type) {
+    case RuntimeEffect::UniformType::Float:
+      return {SLType::Float, "float", 1};
+    case RuntimeEffect::UniformType::Float2:
+      return {SLType::Float2, "vec2", 2};
+    case RuntimeEffect::UniformType::Float3:
+      return {SLType::Float3, "vec3", 3};
+    case RuntimeEffect::UniformType::Float4:
+      return {SLType::Float4, "vec4", 4};
+    case RuntimeEffect::UniformType::Float2x2:
+      return {SLType::Float2x2, "mat2", 4};
+    case RuntimeEffect::UniformType::Float3x3:
+      return {SLType::Float3x3, "mat3", 9};
+    case RuntimeEffect::UniformType::Float4x4:
+      return {SLType::Float4x4, "mat4", 16};
+  }
+  return {SLType::Float, "float", 1};
+}
+
+void GLRuntimeFragmentProcessor::emitCode(EmitArgs& args) const {
+  auto* fragBuilder = args.fragBuilder;
+  // The user code becomes the body of a function, so that it can return early and keep its local
+  // names apart from ours. The function name is mangled to stay unique within the program.
+  auto functionName = "runtimeMain" + fragBuilder->getPipeline()->getMangledSuffix(this);
+  std::string function = "vec4 " + functionName + "(vec2 coord, vec4 color";
+  std::string call = functionName + "(";
+  auto coord = (*args.transformedCoords)[0].name();
+  if (args.coordFunc) {
+    coord = args.coordFunc(coord);
+  }
+  call += coord + ", " + args.inputColor;
+  for (auto& uniform : effect->uniforms()) {
+    auto info = GetUniformInfo(uniform.type);
+    auto uniformName =
+        args.uniformHandler->addUniform(ShaderFlags::Fragment, info.type, uniform.name);
+    function += ", " + info.typeName + " " + uniform.name;
+    call += ", " + uniformName;
+  }
+  for (size_t i = 0; i < numChildProcessors(); ++i) {
+    std::string childColor = "childColor" + std::to_string(i);
+    emitChild(i, &childColor, args);
+    function += ", vec4 child" + std::to_string(i);
+    call += ", " + childColor;
+  }
+  function += ") {\n" + effect->code() + "\n}\n";
+  call += ")";
+  fragBuilder->addFunction(function);
+  fragBuilder->codeAppendf("%s = %s;", args.outputColor.c_str(), call.c_str());
+}
+
+void GLRuntimeFragmentProcessor::onSetData(UniformBuffer* uniformBuffer) const {
+  auto values = uniformValues.data();
+  for (auto& uniform : effect->uniforms()) {
+    auto floatCount = GetUniformInfo(uniform.type).floatCount;
+    uniformBuffer->setData(uniform.name, values, floatCount);
+    values += floatCount;
+  }
+}
+}  // namespace tgfx
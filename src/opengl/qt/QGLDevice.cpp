@@ -90,6 +90,7 @@ std::shared_ptr<QGLDevice> QGLDevice::Wrap(QOpenGLContext* qtContext, QSurface*
   device->externallyOwned = externallyOwned;
   device->qtContext = qtContext;
   device->qtSurface = qtSurface;
+  device->shareRoot = qtContext->shareGroup();
   device->weakThis = device;
   if (oldContext != qtContext) {
     qtContext->doneCurrent();
@@ -141,6 +141,10 @@ void* WebGLProcGetter::getProcAddress(const char* name) const {
   N(glDeleteSync)
   N(glBlitFramebuffer)
   N(glRenderbufferStorageMultisample)
+  N(glBindSampler)
+  N(glDeleteSamplers)
+  N(glGenSamplers)
+  N(glSamplerParameteri)
 #undef N
 
   // We explicitly do not use GetProcAddress or something similar because its code size is quite
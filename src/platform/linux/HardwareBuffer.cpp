@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LinuxHardwareBuffer.h"
+#include "core/PixelBuffer.h"
+#include "tgfx/platform/linux/HardwareBufferFD.h"
+#include "utils/PixelFormatUtil.h"
+
+namespace tgfx {
+std::shared_ptr<ImageBuffer> ImageBuffer::MakeFrom(HardwareBufferRef hardwareBuffer,
+                                                   YUVColorSpace) {
+  return PixelBuffer::MakeFrom(hardwareBuffer);
+}
+
+bool HardwareBufferCheck(HardwareBufferRef buffer) {
+  return LinuxHardwareBuffer::Cast(buffer) != nullptr;
+}
+
+HardwareBufferRef HardwareBufferAllocate(int width, int height, bool alphaOnly) {
+  if (alphaOnly) {
+    return nullptr;
+  }
+  return LinuxHardwareBuffer::Make(width, height);
+}
+
+HardwareBufferRef HardwareBufferRetain(HardwareBufferRef buffer) {
+  auto hardwareBuffer = LinuxHardwareBuffer::Cast(buffer);
+  if (hardwareBuffer != nullptr) {
+    hardwareBuffer->ref();
+  }
+  return buffer;
+}
+
+void HardwareBufferRelease(HardwareBufferRef buffer) {
+  auto hardwareBuffer = LinuxHardwareBuffer::Cast(buffer);
+  if (hardwareBuffer != nullptr) {
+    hardwareBuffer->unref();
+  }
+}
+
+void* HardwareBufferLock(HardwareBufferRef buffer) {
+  auto hardwareBuffer = LinuxHardwareBuffer::Cast(buffer);
+  return hardwareBuffer ? hardwareBuffer->lockPixels() : nullptr;
+}
+
+void HardwareBufferUnlock(HardwareBufferRef buffer) {
+  auto hardwareBuffer = LinuxHardwareBuffer::Cast(buffer);
+  if (hardwareBuffer != nullptr) {
+    hardwareBuffer->unlockPixels();
+  }
+}
+
+ImageInfo HardwareBufferGetInfo(HardwareBufferRef buffer) {
+  auto hardwareBuffer = LinuxHardwareBuffer::Cast(buffer);
+  return hardwareBuffer ? hardwareBuffer->info() : ImageInfo{};
+}
+
+PixelFormat HardwareBufferGetPixelFormat(HardwareBufferRef buffer) {
+  auto info = HardwareBufferGetInfo(buffer);
+  if (info.isEmpty()) {
+    return PixelFormat::Unknown;
+  }
+  return ColorTypeToPixelFormat(info.colorType());
+}
+
+HardwareBufferRef HardwareBufferFromFD(int fd, const ImageInfo& info) {
+  return LinuxHardwareBuffer::MakeFrom(fd, info);
+}
+
+int HardwareBufferGetFD(HardwareBufferRef buffer) {
+  auto hardwareBuffer = LinuxHardwareBuffer::Cast(buffer);
+  return hardwareBuffer ? hardwareBuffer->fd() : -1;
+}
+}  // namespace tgfx
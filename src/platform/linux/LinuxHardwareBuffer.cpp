@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LinuxHardwareBuffer.h"
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#include <mutex>
+#include <unordered_set>
+#if __has_include(<linux/udmabuf.h>)
+#include <linux/udmabuf.h>
+#endif
+#if __has_include(<linux/dma-buf.h>)
+#include <linux/dma-buf.h>
+#endif
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#define MFD_ALLOW_SEALING 0x0002U
+#endif
+#ifndef F_ADD_SEALS
+#define F_ADD_SEALS 1033
+#endif
+#ifndef F_SEAL_SHRINK
+#define F_SEAL_SHRINK 0x0002
+#endif
+
+namespace tgfx {
+// GPUs commonly require the pitch of imported images to be a multiple of 64 bytes.
+static constexpr size_t ROW_BYTES_ALIGNMENT = 64;
+// The file system magic number of dma-buf files, see linux/magic.h.
+static constexpr long DMA_BUF_MAGIC_NUMBER = 0x444d4142;
+
+static std::mutex bufferLocker = {};
+static std::unordered_set<LinuxHardwareBuffer*> liveBuffers = {};
+
+static int GetUdmabufDevice() {
+#if __has_include(<linux/udmabuf.h>)
+  static const int device = open("/dev/udmabuf", O_RDWR | O_CLOEXEC);
+  return device;
+#else
+  return -1;
+#endif
+}
+
+static int CreateSharedMemory(size_t size) {
+#ifdef SYS_memfd_create
+  auto fd = static_cast<int>(
+      syscall(SYS_memfd_create, "tgfx-hardware-buffer", MFD_CLOEXEC | MFD_ALLOW_SEALING));
+  if (fd < 0) {
+    return -1;
+  }
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+#else
+  return -1;
+#endif
+}
+
+static int ExportDmaBuf(int memfd, size_t size) {
+#if __has_include(<linux/udmabuf.h>)
+  auto device = GetUdmabufDevice();
+  if (device < 0) {
+    return -1;
+  }
+  // udmabuf only accepts memory that can not shrink underneath the device.
+  if (fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK) != 0) {
+    return -1;
+  }
+  udmabuf_create create = {};
+  create.memfd = static_cast<uint32_t>(memfd);
+  create.flags = UDMABUF_FLAGS_CLOEXEC;
+  create.offset = 0;
+  create.size = size;
+  return ioctl(device, UDMABUF_CREATE, &create);
+#else
+  return -1;
+#endif
+}
+
+static void SyncDmaBuf(int dmaBufFD, bool start) {
+#if __has_include(<linux/dma-buf.h>)
+  if (dmaBufFD < 0) {
+    return;
+  }
+  dma_buf_sync sync = {};
+  sync.flags = (start ? DMA_BUF_SYNC_START : DMA_BUF_SYNC_END) | DMA_BUF_SYNC_RW;
+  ioctl(dmaBufFD, DMA_BUF_IOCTL_SYNC, &sync);
+#endif
+}
+
+bool LinuxHardwareBuffer::DmaBufAvailable() {
+  return GetUdmabufDevice() >= 0;
+}
+
+LinuxHardwareBuffer* LinuxHardwareBuffer::Make(int width, int height) {
+  if (width <= 0 || height <= 0) {
+    return nullptr;
+  }
+  auto rowBytes = static_cast<size_t>(width) * 4;
+  rowBytes = (rowBytes + ROW_BYTES_ALIGNMENT - 1) / ROW_BYTES_ALIGNMENT * ROW_BYTES_ALIGNMENT;
+  auto info = ImageInfo::Make(width, height, ColorType::RGBA_8888, AlphaType::Premultiplied,
+                              rowBytes);
+  if (info.isEmpty()) {
+    return nullptr;
+  }
+  auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto size = (info.byteSize() + pageSize - 1) / pageSize * pageSize;
+  auto fd = CreateSharedMemory(size);
+  if (fd < 0) {
+    return nullptr;
+  }
+  auto pixels = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (pixels == MAP_FAILED) {
+    close(fd);
+    return nullptr;
+  }
+  auto dmaBufFD = ExportDmaBuf(fd, size);
+  return new LinuxHardwareBuffer(info, fd, dmaBufFD, size, pixels);
+}
+
+/**
+ * Returns true if the pixels can be imported as a dma-buf texture, which requires RGBA_8888 pixels
+ * with either tight rows or rows aligned the same way as the buffers made by Make().
+ */
+static bool IsImportableLayout(const ImageInfo& info) {
+  if (info.colorType() != ColorType::RGBA_8888) {
+    return false;
+  }
+  auto rowBytes = info.rowBytes();
+  return rowBytes == info.minRowBytes() || rowBytes % ROW_BYTES_ALIGNMENT == 0;
+}
+
+LinuxHardwareBuffer* LinuxHardwareBuffer::MakeFrom(int fd, const ImageInfo& info) {
+  if (fd < 0 || info.isEmpty() || !IsImportableLayout(info)) {
+    return nullptr;
+  }
+  auto size = info.byteSize();
+  // Touching the mapped pixels past the end of a shorter file raises SIGBUS, so the file must hold
+  // all the pixels described by info.
+  struct stat fileStat = {};
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0 ||
+      static_cast<size_t>(fileStat.st_size) < size) {
+    return nullptr;
+  }
+  auto sharedFD = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+  if (sharedFD < 0) {
+    return nullptr;
+  }
+  auto pixels = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, sharedFD, 0);
+  if (pixels == MAP_FAILED) {
+    close(sharedFD);
+    return nullptr;
+  }
+  struct statfs fileSystem = {};
+  auto isDmaBuf = fstatfs(sharedFD, &fileSystem) == 0 &&
+                  static_cast<long>(fileSystem.f_type) == DMA_BUF_MAGIC_NUMBER;
+  return new LinuxHardwareBuffer(info, sharedFD, isDmaBuf ? sharedFD : -1, size, pixels);
+}
+
+LinuxHardwareBuffer* LinuxHardwareBuffer::Cast(void* buffer) {
+  if (buffer == nullptr) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> autoLock(bufferLocker);
+  auto hardwareBuffer = static_cast<LinuxHardwareBuffer*>(buffer);
+  return liveBuffers.count(hardwareBuffer) > 0 ? hardwareBuffer : nullptr;
+}
+
+LinuxHardwareBuffer::LinuxHardwareBuffer(const ImageInfo& info, int fd, int dmaBufFD,
+                                         size_t mappedSize, void* pixels)
+    : _info(info), _fd(fd), _dmaBufFD(dmaBufFD), mappedSize(mappedSize), pixels(pixels) {
+  std::lock_guard<std::mutex> autoLock(bufferLocker);
+  liveBuffers.insert(this);
+}
+
+LinuxHardwareBuffer::~LinuxHardwareBuffer() {
+  {
+    std::lock_guard<std::mutex> autoLock(bufferLocker);
+    liveBuffers.erase(this);
+  }
+  munmap(pixels, mappedSize);
+  if (_dmaBufFD >= 0 && _dmaBufFD != _fd) {
+    close(_dmaBufFD);
+  }
+  close(_fd);
+}
+
+void LinuxHardwareBuffer::ref() {
+  refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void LinuxHardwareBuffer::unref() {
+  if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+void* LinuxHardwareBuffer::lockPixels() {
+  SyncDmaBuf(_dmaBufFD, true);
+  return pixels;
+}
+
+void LinuxHardwareBuffer::unlockPixels() {
+  SyncDmaBuf(_dmaBufFD, false);
+}
+}  // namespace tgfx
@@ -0,0 +1,96 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include "tgfx/core/ImageInfo.h"
+
+namespace tgfx {
+/**
+ * LinuxHardwareBuffer is the object behind HardwareBufferRef on Linux. Its pixels live in a
+ * shared-memory file that stays mapped for the lifetime of the buffer, so other processes can map
+ * the same pixels through its file descriptor. When the kernel provides udmabuf, the memory is also
+ * exported as a dma-buf, which EGL can import as a texture without copying.
+ */
+class LinuxHardwareBuffer {
+ public:
+  /**
+   * Returns true if allocated buffers can be exported as dma-bufs.
+   */
+  static bool DmaBufAvailable();
+
+  /**
+   * Allocates a new RGBA_8888 buffer backed by a memfd. Returns nullptr if the shared memory can
+   * not be created or mapped.
+   */
+  static LinuxHardwareBuffer* Make(int width, int height);
+
+  /**
+   * Wraps the pixels of a memfd, shared-memory file or dma-buf that another process shared. The
+   * file descriptor is duplicated, so the caller keeps the ownership of fd. Returns nullptr if the
+   * file is smaller than info.byteSize() or the pixels are not RGBA_8888 with tight or 64-byte
+   * aligned rows.
+   */
+  static LinuxHardwareBuffer* MakeFrom(int fd, const ImageInfo& info);
+
+  /**
+   * Returns the buffer if it is a live LinuxHardwareBuffer, otherwise returns nullptr.
+   */
+  static LinuxHardwareBuffer* Cast(void* buffer);
+
+  void ref();
+
+  void unref();
+
+  const ImageInfo& info() const {
+    return _info;
+  }
+
+  /**
+   * Returns the file descriptor of the shared memory that holds the pixels.
+   */
+  int fd() const {
+    return _fd;
+  }
+
+  /**
+   * Returns the dma-buf file descriptor of the pixels, or -1 if the memory is not a dma-buf.
+   */
+  int dmaBufFD() const {
+    return _dmaBufFD;
+  }
+
+  void* lockPixels();
+
+  void unlockPixels();
+
+ private:
+  std::atomic_int refCount = {1};
+  ImageInfo _info = {};
+  int _fd = -1;
+  int _dmaBufFD = -1;
+  size_t mappedSize = 0;
+  void* pixels = nullptr;
+
+  LinuxHardwareBuffer(const ImageInfo& info, int fd, int dmaBufFD, size_t mappedSize,
+                      void* pixels);
+
+  ~LinuxHardwareBuffer();
+};
+}  // namespace tgfx
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PictureShader.h"
+#include "gpu/processors/FragmentProcessor.h"
+#include "images/PictureImage.h"
+
+namespace tgfx {
+// The scale levels are powers of two, clamped to keep the tile texture within a sane size range.
+static constexpr int kMinScaleLevel = -8;
+static constexpr int kMaxScaleLevel = 8;
+
+std::shared_ptr<Shader> Shader::MakePictureShader(std::shared_ptr<Picture> picture,
+                                                  TileMode tileModeX, TileMode tileModeY,
+                                                  const Matrix* localMatrix, const Rect* tile) {
+  if (picture == nullptr) {
+    return nullptr;
+  }
+  auto tileRect = tile ? *tile : picture->getBounds();
+  if (tileRect.isEmpty()) {
+    return nullptr;
+  }
+  auto shader = std::shared_ptr<PictureShader>(
+      new PictureShader(std::move(picture), tileModeX, tileModeY, tileRect));
+  shader->weakThis = shader;
+  if (localMatrix) {
+    return shader->makeWithMatrix(*localMatrix);
+  }
+  return shader;
+}
+
+PictureShader::PictureShader(std::shared_ptr<Picture> picture, TileMode tileModeX,
+                             TileMode tileModeY, const Rect& tile)
+    : picture(std::move(picture)), tileModeX(tileModeX), tileModeY(tileModeY), tile(tile) {
+}
+
+static int GetTileSize(float length, int scaleLevel) {
+  return std::max(static_cast<int>(ceilf(length * ldexpf(1.0f, scaleLevel))), 1);
+}
+
+std::shared_ptr<Image> PictureShader::getTileImage(int scaleLevel) const {
+  std::lock_guard<std::mutex> autoLock(locker);
+  auto result = tileImages.find(scaleLevel);
+  if (result != tileImages.end()) {
+    return result->second;
+  }
+  auto width = GetTileSize(tile.width(), scaleLevel);
+  auto height = GetTileSize(tile.height(), scaleLevel);
+  // Uses separate scales for each axis so that the tile image covers the tile exactly.
+  auto matrix = Matrix::MakeTrans(-tile.left, -tile.top);
+  matrix.postScale(static_cast<float>(width) / tile.width(),
+                   static_cast<float>(height) / tile.height());
+  auto image = PictureImage::MakeFrom(picture, width, height, matrix);
+  tileImages[scaleLevel] = image;
+  return image;
+}
+
+std::unique_ptr<FragmentProcessor> PictureShader::asFragmentProcessor(
+    const FPArgs& args, const Matrix* localMatrix) const {
+  // The localMatrix maps the local coordinates of the draw to the coordinates of the picture.
+  auto totalMatrix = localMatrix ? *localMatrix : Matrix::I();
+  Matrix pictureToDevice = {};
+  if (!totalMatrix.invert(&pictureToDevice)) {
+    return nullptr;
+  }
+  pictureToDevice.postConcat(args.viewMatrix);
+  auto scale = pictureToDevice.getMaxScale();
+  if (scale <= 0) {
+    return nullptr;
+  }
+  auto scaleLevel = static_cast<int>(ceilf(log2f(scale)));
+  scaleLevel = std::clamp(scaleLevel, kMinScaleLevel, kMaxScaleLevel);
+  auto maxTextureSize = static_cast<float>(args.context->caps()->maxTextureSize);
+  while (scaleLevel > kMinScaleLevel &&
+         static_cast<float>(std::max(GetTileSize(tile.width(), scaleLevel),
+                                     GetTileSize(tile.height(), scaleLevel))) > maxTextureSize) {
+    scaleLevel--;
+  }
+  auto image = getTileImage(scaleLevel);
+  if (image == nullptr) {
+    return nullptr;
+  }
+  totalMatrix.postTranslate(-tile.left, -tile.top);
+  totalMatrix.postScale(static_cast<float>(image->width()) / tile.width(),
+                        static_cast<float>(image->height()) / tile.height());
+  SamplingOptions sampling(FilterMode::Linear);
+  return FragmentProcessor::Make(std::move(image), args, tileModeX, tileModeY, sampling,
+                                 &totalMatrix);
+}
+}  // namespace tgfx
@@ -0,0 +1,52 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include "tgfx/core/Picture.h"
+#include "tgfx/core/Shader.h"
+
+namespace tgfx {
+/**
+ * PictureShader tiles the content of a Picture. The tile is rasterized into a texture at a
+ * power-of-two scale bucket that matches the current drawing scale, and each bucket is kept for
+ * reuse across draws.
+ */
+class PictureShader : public Shader {
+ protected:
+  std::unique_ptr<FragmentProcessor> asFragmentProcessor(const FPArgs& args,
+                                                         const Matrix* localMatrix) const override;
+
+ private:
+  std::shared_ptr<Picture> picture = nullptr;
+  TileMode tileModeX = TileMode::Clamp;
+  TileMode tileModeY = TileMode::Clamp;
+  Rect tile = Rect::MakeEmpty();
+  mutable std::mutex locker = {};
+  mutable std::unordered_map<int, std::shared_ptr<Image>> tileImages = {};
+
+  PictureShader(std::shared_ptr<Picture> picture, TileMode tileModeX, TileMode tileModeY,
+                const Rect& tile);
+
+  std::shared_ptr<Image> getTileImage(int scaleLevel) const;
+
+  friend class Shader;
+};
+}  // namespace tgfx
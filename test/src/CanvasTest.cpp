@@ -16,22 +16,31 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "core/MaskTileGrid.h"
+#include "core/PathTriangulator.h"
+#include "gpu/ColorGlyphCache.h"
 #include "gpu/DrawingManager.h"
+#include "gpu/ResourceProvider.h"
 #include "gpu/Texture.h"
+#include "gpu/ops/ConvexPathOp.h"
 #include "gpu/ops/FillRectOp.h"
 #include "gpu/ops/RRectOp.h"
 #include "images/ResourceImage.h"
 #include "images/TransformImage.h"
 #include "opengl/GLCaps.h"
+#include "opengl/GLGpu.h"
 #include "opengl/GLSampler.h"
 #include "tgfx/core/Canvas.h"
 #include "tgfx/core/ImageCodec.h"
 #include "tgfx/core/ImageReader.h"
 #include "tgfx/core/Mask.h"
 #include "tgfx/core/PathEffect.h"
+#include "tgfx/core/PathMeasure.h"
 #include "tgfx/core/Recorder.h"
+#include "tgfx/core/RuntimeEffect.h"
 #include "tgfx/gpu/Surface.h"
 #include "tgfx/opengl/GLFunctions.h"
+#include "utils/MathExtra.h"
 #include "utils/TestUtils.h"
 #include "utils/TextShaper.h"
 
@@ -88,6 +97,37 @@ TGFX_TEST(CanvasTest, TileMode) {
   device->unlock();
 }
 
+TGFX_TEST(CanvasTest, SamplerObjectCache) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto image = MakeImage("resources/apitest/rotation.jpg");
+  ASSERT_TRUE(image != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint paint;
+  paint.setShader(Shader::MakeImageShader(image, TileMode::Repeat, TileMode::Mirror)
+                      ->makeWithMatrix(Matrix::MakeScale(0.125f)));
+  canvas->drawRect(Rect::MakeWH(50, 50), paint);
+  surface->flush();
+  auto gpu = static_cast<GLGpu*>(context->gpu());
+  EXPECT_TRUE(gpu->boundSamplerObjects.empty());
+  if (!GLCaps::Get(context)->samplerObjectSupport) {
+    EXPECT_TRUE(gpu->samplerObjects.empty());
+    device->unlock();
+    return;
+  }
+  EXPECT_FALSE(gpu->samplerObjects.empty());
+  // Drawing again with the same SamplerState reuses the cached sampler object.
+  auto samplerCount = gpu->samplerObjects.size();
+  canvas->drawRect(Rect::MakeXYWH(50, 50, 50, 50), paint);
+  surface->flush();
+  EXPECT_EQ(gpu->samplerObjects.size(), samplerCount);
+  EXPECT_TRUE(gpu->boundSamplerObjects.empty());
+  device->unlock();
+}
+
 TGFX_TEST(CanvasTest, merge_draw_call_rect) {
   auto device = DevicePool::Make();
   ASSERT_TRUE(device != nullptr);
@@ -769,4 +809,661 @@ TGFX_TEST(CanvasTest, Picture) {
   EXPECT_TRUE(Baseline::Compare(surface, "CanvasTest/Picture"));
   device->unlock();
 }
+
+TGFX_TEST(CanvasTest, ClippedLayer) {
+  Recorder recorder = {};
+  auto canvas = recorder.beginRecording();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawRect(Rect::MakeXYWH(-5000, -5000, 10000, 10000), paint);
+  canvas->drawRect(Rect::MakeXYWH(0, 0, 100, 100), paint);
+  auto picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  canvas = surface->getCanvas();
+  canvas->save();
+  canvas->clipRect(Rect::MakeXYWH(10, 10, 50, 50));
+  Paint layerPaint = {};
+  layerPaint.setAlpha(0.5f);
+  canvas->drawPicture(picture, nullptr, &layerPaint);
+  canvas->restore();
+  auto color = surface->getColor(30, 30);
+  EXPECT_NEAR(color.alpha, 0.5f, 0.01f);
+  color = surface->getColor(5, 5);
+  EXPECT_EQ(color.alpha, 0.0f);
+  canvas->clear();
+  canvas->clipRect(Rect::MakeXYWH(10, 10, 50, 50));
+  auto blurPaint = layerPaint;
+  blurPaint.setAlpha(1.0f);
+  blurPaint.setImageFilter(ImageFilter::Blur(5, 5));
+  canvas->drawPicture(picture, nullptr, &blurPaint);
+  color = surface->getColor(30, 30);
+  EXPECT_NEAR(color.alpha, 1.0f, 0.01f);
+  color = surface->getColor(80, 80);
+  EXPECT_EQ(color.alpha, 0.0f);
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, PictureHitTest) {
+  Recorder recorder = {};
+  auto canvas = recorder.beginRecording();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  Path path = {};
+  path.addOval(Rect::MakeXYWH(0, 0, 100, 100));
+  canvas->drawPath(path, paint);
+  canvas->save();
+  canvas->translate(200, 0);
+  canvas->clipRect(Rect::MakeXYWH(0, 0, 50, 100));
+  canvas->drawRect(Rect::MakeXYWH(0, 0, 100, 100), paint);
+  canvas->restore();
+  paint.setStyle(PaintStyle::Stroke);
+  paint.setStrokeWidth(10);
+  canvas->drawRect(Rect::MakeXYWH(0, 200, 100, 100), paint);
+  auto picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  EXPECT_TRUE(picture->hitTest(50, 50));
+  EXPECT_FALSE(picture->hitTest(5, 5));
+  EXPECT_TRUE(picture->hitTest(220, 50));
+  EXPECT_FALSE(picture->hitTest(270, 50));
+  EXPECT_TRUE(picture->hitTest(2, 250));
+  EXPECT_FALSE(picture->hitTest(50, 250));
+
+  canvas = recorder.beginRecording();
+  canvas->scale(0.5f, 0.5f);
+  canvas->drawPicture(picture);
+  auto scaledPicture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(scaledPicture != nullptr);
+  EXPECT_TRUE(scaledPicture->hitTest(25, 25));
+  EXPECT_FALSE(scaledPicture->hitTest(50, 50));
+}
+
+TGFX_TEST(CanvasTest, GetColors) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 200, 200);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawRect(Rect::MakeXYWH(0, 0, 10, 10), paint);
+  paint.setColor(Color::Blue());
+  canvas->drawRect(Rect::MakeXYWH(190, 190, 10, 10), paint);
+  std::vector<Point> points = {Point::Make(5.5f, 5.5f), Point::Make(195, 195),
+                               Point::Make(100, 100), Point::Make(-1, 5)};
+  auto colors = surface->getColors(points);
+  ASSERT_EQ(colors.size(), points.size());
+  EXPECT_EQ(colors[0], Color::Red());
+  EXPECT_EQ(colors[1], Color::Blue());
+  EXPECT_EQ(colors[2], Color::Transparent());
+  EXPECT_EQ(colors[3], Color::Transparent());
+  points = {Point::Make(2, 2), Point::Make(3, 4)};
+  colors = surface->getColors(points);
+  EXPECT_EQ(colors[0], Color::Red());
+  EXPECT_EQ(colors[1], Color::Red());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, PathMeasureBatch) {
+  Path path = {};
+  path.moveTo(0, 0);
+  path.lineTo(100, 0);
+  path.lineTo(100, 100);
+  auto pathMeasure = PathMeasure::MakeFrom(path);
+  EXPECT_FLOAT_EQ(pathMeasure->getLength(), 200.0f);
+  auto samePathMeasure = PathMeasure::MakeFrom(path);
+  EXPECT_FLOAT_EQ(samePathMeasure->getLength(), 200.0f);
+  float distances[] = {0.0f, 50.0f, 150.0f, 300.0f};
+  Point positions[4] = {};
+  Point tangents[4] = {};
+  EXPECT_TRUE(pathMeasure->getPosTan(distances, 4, positions, tangents));
+  EXPECT_EQ(positions[1], Point::Make(50, 0));
+  EXPECT_EQ(tangents[1], Point::Make(1, 0));
+  EXPECT_EQ(positions[2], Point::Make(100, 50));
+  EXPECT_EQ(tangents[2], Point::Make(0, 1));
+  EXPECT_EQ(positions[3], Point::Make(100, 100));
+  float invalidDistances[] = {20.0f, std::nanf("")};
+  Point invalidPositions[2] = {};
+  Point invalidTangents[2] = {};
+  EXPECT_FALSE(pathMeasure->getPosTan(invalidDistances, 2, invalidPositions, invalidTangents));
+  EXPECT_EQ(invalidPositions[0], Point::Zero());
+  EXPECT_EQ(invalidTangents[0], Point::Zero());
+  float startD[] = {0.0f, 50.0f, 120.0f};
+  float stopD[] = {50.0f, 50.0f, 150.0f};
+  Path segments[3] = {};
+  EXPECT_EQ(pathMeasure->getSegment(startD, stopD, 3, segments), 2u);
+  EXPECT_EQ(segments[0].getBounds(), Rect::MakeLTRB(0, 0, 50, 0));
+  EXPECT_TRUE(segments[1].isEmpty());
+  EXPECT_EQ(segments[2].getBounds(), Rect::MakeLTRB(100, 20, 100, 50));
+  path.lineTo(0, 100);
+  EXPECT_FLOAT_EQ(PathMeasure::MakeFrom(path)->getLength(), 300.0f);
+  EXPECT_FLOAT_EQ(pathMeasure->getLength(), 200.0f);
+}
+
+TGFX_TEST(CanvasTest, ConvexPath) {
+  Path path = {};
+  path.moveTo(10, 10);
+  path.lineTo(90, 10);
+  path.quadTo(90, 90, 10, 90);
+  path.close();
+  EXPECT_TRUE(ConvexPathOp::CanDraw(path));
+  std::vector<float> vertices = {};
+  EXPECT_GT(PathTriangulator::ToConvexAATriangles(path, &vertices), 0u);
+  Path concavePath = {};
+  concavePath.moveTo(10, 10);
+  concavePath.lineTo(90, 10);
+  concavePath.lineTo(50, 50);
+  concavePath.lineTo(90, 90);
+  concavePath.lineTo(10, 90);
+  concavePath.close();
+  EXPECT_FALSE(ConvexPathOp::CanDraw(concavePath));
+  // Modifying the path resets its cached convexity.
+  Path editedPath = {};
+  editedPath.addRect(Rect::MakeWH(90, 90));
+  EXPECT_TRUE(ConvexPathOp::CanDraw(editedPath));
+  editedPath.addRect(Rect::MakeXYWH(100, 100, 10, 10));
+  EXPECT_FALSE(ConvexPathOp::CanDraw(editedPath));
+
+  Path pointPath = {};
+  pointPath.moveTo(30, 40);
+  EXPECT_EQ(pointPath.getBounds(), Rect::MakeLTRB(30, 40, 30, 40));
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawPath(path, paint);
+  EXPECT_EQ(surface->getColor(20, 20), Color::Red());
+  EXPECT_EQ(surface->getColor(50, 50), Color::Red());
+  EXPECT_EQ(surface->getColor(85, 85), Color::Transparent());
+  EXPECT_EQ(surface->getColor(5, 5), Color::Transparent());
+  EXPECT_EQ(surface->getColor(50, 10), Color::Red());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, OccludedOps) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Path path = {};
+  path.moveTo(10, 10);
+  path.lineTo(20, 10);
+  path.lineTo(15, 20);
+  path.close();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawPath(path, paint);
+  canvas->clearRect(Rect::MakeXYWH(0, 0, 50, 50), Color::Blue());
+  auto opsTask = context->drawingManager()->activeOpsTask;
+  ASSERT_TRUE(opsTask != nullptr);
+  EXPECT_EQ(opsTask->ops.size(), 3u);
+  opsTask->removeOccludedOps();
+  EXPECT_EQ(opsTask->ops.size(), 2u);
+  EXPECT_EQ(surface->getColor(15, 12), Color::Blue());
+  EXPECT_EQ(surface->getColor(60, 60), Color::Transparent());
+  surface->flush();
+  // A color filter that keeps the alpha still hides the ops underneath.
+  canvas->drawPath(path, paint);
+  Paint filterPaint = {};
+  filterPaint.setColorFilter(ColorFilter::Blend(Color::Green(), BlendMode::SrcATop));
+  canvas->drawRect(Rect::MakeWH(50, 50), filterPaint);
+  opsTask = context->drawingManager()->activeOpsTask;
+  ASSERT_TRUE(opsTask != nullptr);
+  EXPECT_EQ(opsTask->ops.size(), 2u);
+  opsTask->removeOccludedOps();
+  EXPECT_EQ(opsTask->ops.size(), 1u);
+  surface->flush();
+  // A color filter that lowers the alpha does not.
+  canvas->drawPath(path, paint);
+  filterPaint.setColorFilter(ColorFilter::Matrix(
+      {1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0.5f, 0}));
+  canvas->drawRect(Rect::MakeWH(50, 50), filterPaint);
+  opsTask = context->drawingManager()->activeOpsTask;
+  ASSERT_TRUE(opsTask != nullptr);
+  EXPECT_EQ(opsTask->ops.size(), 2u);
+  opsTask->removeOccludedOps();
+  EXPECT_EQ(opsTask->ops.size(), 2u);
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, OccludedOpsWithMasks) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  auto drawRectUnder = [&](const std::function<void()>& drawOver) {
+    canvas->clear();
+    surface->flush();
+    canvas->drawRect(Rect::MakeXYWH(40, 40, 10, 10), paint);
+    drawOver();
+    auto opsTask = context->drawingManager()->activeOpsTask;
+    EXPECT_TRUE(opsTask != nullptr);
+    if (opsTask == nullptr) {
+      return;
+    }
+    auto opCount = opsTask->ops.size();
+    opsTask->removeOccludedOps();
+    EXPECT_EQ(opsTask->ops.size(), opCount);
+  };
+  // A rect under text.
+  auto typeface = MakeTypeface("resources/font/NotoSansSC-Regular.otf");
+  ASSERT_TRUE(typeface != nullptr);
+  Font font(typeface, 80);
+  Paint textPaint = {};
+  drawRectUnder([&] { canvas->drawSimpleText("O", 20, 80, font, textPaint); });
+  // A rect under a half-transparent image.
+  auto imageSurface = Surface::Make(context, 100, 100);
+  ASSERT_TRUE(imageSurface != nullptr);
+  imageSurface->getCanvas()->clearRect(Rect::MakeWH(100, 100), Color::FromRGBA(0, 0, 255, 128));
+  auto image = imageSurface->makeImageSnapshot();
+  drawRectUnder([&] { canvas->drawImage(image); });
+  auto color = surface->getColor(45, 45);
+  EXPECT_GT(color.red, 0.f);
+  EXPECT_GT(color.blue, 0.f);
+  // A rect under a single emoji.
+  auto emojiTypeface = MakeTypeface("resources/font/NotoColorEmoji.ttf");
+  ASSERT_TRUE(emojiTypeface != nullptr);
+  Font emojiFont(emojiTypeface, 80);
+  drawRectUnder([&] { canvas->drawSimpleText("🤡", 10, 90, emojiFont, textPaint); });
+  // A rect under a batch of rects with a gap where the rect is.
+  drawRectUnder([&] {
+    Rect rects[] = {Rect::MakeXYWH(0, 0, 10, 10), Rect::MakeXYWH(90, 90, 10, 10)};
+    canvas->drawRects(rects, 2, textPaint);
+  });
+  EXPECT_EQ(surface->getColor(45, 45), Color::Red());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, RuntimeEffect) {
+  EXPECT_TRUE(RuntimeEffect::Make("") == nullptr);
+  auto floatType = RuntimeEffect::UniformType::Float;
+  EXPECT_TRUE(RuntimeEffect::Make("return color;", {{"color", floatType}}) == nullptr);
+  EXPECT_TRUE(RuntimeEffect::Make("return color;", {{"1x", floatType}}) == nullptr);
+  auto splitEffect =
+      RuntimeEffect::Make("return coord.x < 50.0 ? vec4(1.0, 0.0, 0.0, 1.0) : tint;",
+                          {{"tint", RuntimeEffect::UniformType::Float4}});
+  ASSERT_TRUE(splitEffect != nullptr);
+  EXPECT_EQ(splitEffect->uniformSize(), 4u);
+  EXPECT_TRUE(splitEffect->makeShader({0, 0, 1}) == nullptr);
+  auto invertEffect = RuntimeEffect::Make("return vec4(color.a - color.rgb, color.a);");
+  ASSERT_TRUE(invertEffect != nullptr);
+  auto swizzleEffect = RuntimeEffect::Make("return child0.gbra;", {}, 1);
+  ASSERT_TRUE(swizzleEffect != nullptr);
+  EXPECT_TRUE(swizzleEffect->makeShader({}) == nullptr);
+  EXPECT_TRUE(swizzleEffect->makeColorFilter({}) == nullptr);
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setShader(splitEffect->makeShader({0, 0, 1, 1}));
+  canvas->drawRect(Rect::MakeWH(100, 50), paint);
+  paint.setShader(swizzleEffect->makeShader({}, {Shader::MakeColorShader(Color::Green())}));
+  canvas->drawRect(Rect::MakeXYWH(0, 50, 50, 50), paint);
+  paint.setShader(nullptr);
+  paint.setColor(Color::Red());
+  paint.setColorFilter(invertEffect->makeColorFilter({}));
+  canvas->drawRect(Rect::MakeXYWH(50, 50, 50, 50), paint);
+  EXPECT_EQ(surface->getColor(25, 25), Color::Red());
+  EXPECT_EQ(surface->getColor(75, 25), Color::Blue());
+  EXPECT_EQ(surface->getColor(25, 75), Color::Red());
+  EXPECT_EQ(surface->getColor(75, 75), Color::FromRGBA(0, 255, 255, 255));
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, DrawVertices) {
+  Point positions[] = {{0, 0}, {50, 0}, {50, 50}, {0, 50}};
+  Color colors[] = {Color::Red(), Color::Red(), Color::Red(), Color::Red()};
+  uint16_t indices[] = {0, 1, 2, 0, 2, 3};
+  EXPECT_TRUE(Vertices::MakeCopy(positions, nullptr, nullptr, 2) == nullptr);
+  uint16_t badIndices[] = {0, 1, 4};
+  EXPECT_TRUE(Vertices::MakeCopy(positions, nullptr, nullptr, 4, badIndices, 3) == nullptr);
+  auto quad = Vertices::MakeCopy(positions, nullptr, colors, 4, indices, 6);
+  ASSERT_TRUE(quad != nullptr);
+  EXPECT_EQ(quad->bounds(), Rect::MakeWH(50, 50));
+  Point trianglePositions[] = {{50, 50}, {100, 50}, {50, 100}};
+  Point texCoords[] = {{0, 0}, {1, 0}, {0, 1}};
+  auto triangle = Vertices::MakeCopy(trianglePositions, texCoords, nullptr, 3);
+  ASSERT_TRUE(triangle != nullptr);
+
+  Recorder recorder = {};
+  auto canvas = recorder.beginRecording();
+  Paint paint = {};
+  canvas->drawVertices(quad, paint);
+  paint.setShader(Shader::MakeColorShader(Color::Blue()));
+  canvas->drawVertices(triangle, paint);
+  auto picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  EXPECT_EQ(picture->getBounds(), Rect::MakeWH(100, 100));
+  EXPECT_TRUE(picture->hitTest(25, 25));
+  EXPECT_TRUE(picture->hitTest(60, 60));
+  EXPECT_FALSE(picture->hitTest(90, 90));
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  surface->getCanvas()->drawPicture(picture);
+  EXPECT_EQ(surface->getColor(25, 25), Color::Red());
+  EXPECT_EQ(surface->getColor(60, 60), Color::Blue());
+  EXPECT_EQ(surface->getColor(90, 90), Color::Transparent());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, DrawPrimitiveArrays) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  std::vector<Rect> rects = {};
+  for (int i = 0; i < 10; i++) {
+    rects.push_back(Rect::MakeXYWH(static_cast<float>(i * 10), 0.f, 5.f, 5.f));
+  }
+  canvas->drawRects(rects.data(), rects.size(), paint);
+  paint.setColor(Color::Green());
+  RRect rRects[2] = {};
+  rRects[0].setRectXY(Rect::MakeXYWH(0, 10, 20, 20), 5, 5);
+  rRects[1].setRectXY(Rect::MakeXYWH(30, 10, 20, 20), 0, 0);
+  canvas->drawRRects(rRects, 2, paint);
+  paint.setColor(Color::Blue());
+  paint.setStrokeWidth(4);
+  Point points[] = {{10, 50}, {30, 50}};
+  canvas->drawPoints(points, 2, paint);
+  paint.setLineCap(LineCap::Butt);
+  Point lines[] = {{0, 70}, {100, 70}, {50, 60}, {50, 100}, {0, 0}};
+  canvas->drawLines(lines, 5, paint);
+  EXPECT_EQ(surface->getColor(2, 2), Color::Red());
+  EXPECT_EQ(surface->getColor(92, 2), Color::Red());
+  EXPECT_EQ(surface->getColor(7, 2), Color::Transparent());
+  EXPECT_EQ(surface->getColor(10, 20), Color::Green());
+  EXPECT_EQ(surface->getColor(0, 10), Color::Transparent());
+  EXPECT_EQ(surface->getColor(30, 10), Color::Green());
+  EXPECT_EQ(surface->getColor(10, 50), Color::Blue());
+  EXPECT_EQ(surface->getColor(30, 50), Color::Blue());
+  EXPECT_EQ(surface->getColor(20, 50), Color::Transparent());
+  EXPECT_EQ(surface->getColor(10, 70), Color::Blue());
+  EXPECT_EQ(surface->getColor(50, 90), Color::Blue());
+  EXPECT_EQ(surface->getColor(10, 90), Color::Transparent());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, DrawTinyRoundPoints) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  paint.setLineCap(LineCap::Round);
+  paint.setStrokeWidth(0.5f);
+  Point subPixelPoints[] = {{10.5f, 10.5f}, {30.5f, 10.5f}};
+  canvas->drawPoints(subPixelPoints, 2, paint);
+  canvas->save();
+  canvas->scale(4, 4);
+  paint.setStrokeWidth(0);
+  Point hairlinePoints[] = {{5.125f, 10.125f}, {10.125f, 10.125f}};
+  canvas->drawPoints(hairlinePoints, 2, paint);
+  canvas->restore();
+  paint.setStrokeWidth(10);
+  Point largePoints[] = {{20, 80}, {1.5f, 1.5f}};
+  canvas->drawPoints(largePoints, 2, paint);
+  EXPECT_GT(surface->getColor(10, 10).alpha, 0.f);
+  EXPECT_GT(surface->getColor(30, 10).alpha, 0.f);
+  EXPECT_GT(surface->getColor(20, 40).alpha, 0.f);
+  EXPECT_GT(surface->getColor(40, 40).alpha, 0.f);
+  EXPECT_EQ(surface->getColor(20, 80), Color::Red());
+  EXPECT_EQ(surface->getColor(20, 20), Color::Transparent());
+  EXPECT_EQ(surface->getColor(30, 40), Color::Transparent());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, DrawImageNine) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto skinSurface = Surface::Make(context, 30, 30);
+  auto skinCanvas = skinSurface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Blue());
+  skinCanvas->drawRect(Rect::MakeWH(30, 30), paint);
+  paint.setColor(Color::Red());
+  Rect corners[] = {Rect::MakeXYWH(0, 0, 10, 10), Rect::MakeXYWH(20, 0, 10, 10),
+                    Rect::MakeXYWH(0, 20, 10, 10), Rect::MakeXYWH(20, 20, 10, 10)};
+  skinCanvas->drawRects(corners, 4, paint);
+  auto skin = skinSurface->makeImageSnapshot();
+  ASSERT_TRUE(skin != nullptr);
+
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  canvas->drawImageNine(skin, Rect::MakeLTRB(10, 10, 20, 20), Rect::MakeWH(100, 60),
+                        FilterMode::Nearest);
+  EXPECT_EQ(surface->getColor(5, 5), Color::Red());
+  EXPECT_EQ(surface->getColor(95, 5), Color::Red());
+  EXPECT_EQ(surface->getColor(5, 55), Color::Red());
+  EXPECT_EQ(surface->getColor(95, 55), Color::Red());
+  EXPECT_EQ(surface->getColor(15, 5), Color::Blue());
+  EXPECT_EQ(surface->getColor(50, 30), Color::Blue());
+  EXPECT_EQ(surface->getColor(50, 65), Color::Transparent());
+
+  int xDivs[] = {10, 20};
+  Lattice lattice = {};
+  lattice.xDivs = xDivs;
+  lattice.xCount = 2;
+  canvas->clear();
+  canvas->drawImageLattice(skin, lattice, Rect::MakeXYWH(0, 70, 100, 30), FilterMode::Nearest);
+  EXPECT_EQ(surface->getColor(5, 75), Color::Red());
+  EXPECT_EQ(surface->getColor(95, 75), Color::Red());
+  EXPECT_EQ(surface->getColor(50, 75), Color::Blue());
+  EXPECT_EQ(surface->getColor(5, 85), Color::Blue());
+  EXPECT_EQ(surface->getColor(5, 30), Color::Transparent());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, DrawImageNineWithShader) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto maskSurface = Surface::Make(context, 30, 30, true);
+  ASSERT_TRUE(maskSurface != nullptr);
+  Paint paint = {};
+  maskSurface->getCanvas()->drawRect(Rect::MakeWH(30, 30), paint);
+  auto mask = maskSurface->makeImageSnapshot();
+  ASSERT_TRUE(mask != nullptr);
+  ASSERT_TRUE(mask->isAlphaOnly());
+
+  // The left half of the destination is red and the right half is blue.
+  auto shader = Shader::MakeLinearGradient(Point::Make(0, 0), Point::Make(100, 0),
+                                           {Color::Red(), Color::Red(), Color::Blue(),
+                                            Color::Blue()},
+                                           {0.0f, 0.5f, 0.5f, 1.0f});
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  paint.setShader(shader);
+  canvas->drawImageNine(mask, Rect::MakeLTRB(10, 10, 20, 20), Rect::MakeWH(100, 60),
+                        FilterMode::Nearest, &paint);
+  EXPECT_EQ(surface->getColor(5, 5), Color::Red());
+  EXPECT_EQ(surface->getColor(40, 30), Color::Red());
+  EXPECT_EQ(surface->getColor(60, 30), Color::Blue());
+  EXPECT_EQ(surface->getColor(95, 55), Color::Blue());
+
+  // The mask filter keeps only the left half of the destination.
+  auto maskShader = Shader::MakeLinearGradient(Point::Make(0, 0), Point::Make(100, 0),
+                                               {Color::White(), Color::White(),
+                                                Color::Transparent(), Color::Transparent()},
+                                               {0.0f, 0.5f, 0.5f, 1.0f});
+  auto colorSurface = Surface::Make(context, 30, 30);
+  ASSERT_TRUE(colorSurface != nullptr);
+  Paint colorPaint = {};
+  colorPaint.setColor(Color::Green());
+  colorSurface->getCanvas()->drawRect(Rect::MakeWH(30, 30), colorPaint);
+  auto image = colorSurface->makeImageSnapshot();
+  ASSERT_TRUE(image != nullptr);
+  canvas->clear();
+  Paint maskPaint = {};
+  maskPaint.setMaskFilter(MaskFilter::MakeShader(maskShader));
+  canvas->drawImageNine(image, Rect::MakeLTRB(10, 10, 20, 20), Rect::MakeWH(100, 60),
+                        FilterMode::Nearest, &maskPaint);
+  EXPECT_EQ(surface->getColor(5, 5), Color::Green());
+  EXPECT_EQ(surface->getColor(40, 30), Color::Green());
+  EXPECT_EQ(surface->getColor(60, 30), Color::Transparent());
+  EXPECT_EQ(surface->getColor(95, 55), Color::Transparent());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, PictureShader) {
+  Recorder recorder = {};
+  auto patternCanvas = recorder.beginRecording();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  patternCanvas->drawRect(Rect::MakeXYWH(0, 0, 5, 5), paint);
+  paint.setColor(Color::Blue());
+  patternCanvas->drawRect(Rect::MakeXYWH(5, 5, 5, 5), paint);
+  auto picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  auto shader = Shader::MakePictureShader(picture);
+  ASSERT_TRUE(shader != nullptr);
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  auto canvas = surface->getCanvas();
+  Paint shaderPaint = {};
+  shaderPaint.setShader(shader);
+  canvas->drawRect(Rect::MakeWH(50, 50), shaderPaint);
+  canvas->save();
+  canvas->translate(50, 50);
+  canvas->scale(2, 2);
+  canvas->drawRect(Rect::MakeWH(25, 25), shaderPaint);
+  canvas->restore();
+  EXPECT_EQ(surface->getColor(2, 2), Color::Red());
+  EXPECT_EQ(surface->getColor(7, 7), Color::Blue());
+  EXPECT_EQ(surface->getColor(42, 42), Color::Red());
+  EXPECT_EQ(surface->getColor(17, 2), Color::Transparent());
+  EXPECT_EQ(surface->getColor(52, 52), Color::Red());
+  EXPECT_EQ(surface->getColor(65, 65), Color::Blue());
+  EXPECT_EQ(surface->getColor(75, 52), Color::Red());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, TiledMaskPath) {
+  // A polygon with this many points is too expensive to triangulate, so it goes to the mask path.
+  Path path = {};
+  constexpr int PointCount = 4000;
+  for (int i = 0; i < PointCount; i++) {
+    auto angle = static_cast<float>(i) * 2.0f * M_PI_F / PointCount;
+    auto x = 400.0f + 350.0f * cosf(angle);
+    auto y = 400.0f + 350.0f * sinf(angle);
+    if (i == 0) {
+      path.moveTo(x, y);
+    } else {
+      path.lineTo(x, y);
+    }
+  }
+  path.close();
+  auto maskPath = path;
+  maskPath.transform(Matrix::MakeTrans(-50, -50));
+  MaskTileGrid grid(maskPath, 700, 700, 256);
+  EXPECT_EQ(grid.columns(), 3);
+  EXPECT_EQ(grid.rows(), 3);
+  EXPECT_TRUE(grid.coverage(1, 1) == TileCoverage::Full);
+  EXPECT_TRUE(grid.coverage(0, 0) == TileCoverage::Partial);
+  EXPECT_EQ(grid.getTileRect(2, 2), Rect::MakeLTRB(512, 512, 700, 700));
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 800, 800);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawPath(path, paint);
+  EXPECT_EQ(surface->getColor(400, 400), Color::Red());
+  EXPECT_EQ(surface->getColor(100, 400), Color::Red());
+  EXPECT_EQ(surface->getColor(400, 700), Color::Red());
+  EXPECT_EQ(surface->getColor(60, 60), Color::Transparent());
+  EXPECT_EQ(surface->getColor(780, 780), Color::Transparent());
+  device->unlock();
+}
+
+TGFX_TEST(CanvasTest, ColorGlyphAtlas) {
+  EXPECT_EQ(ColorGlyphCache::BucketTextSize(30.0f), 32.0f);
+  EXPECT_EQ(ColorGlyphCache::BucketTextSize(32.0f), 32.0f);
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto typeface = MakeTypeface("resources/font/NotoColorEmoji.ttf");
+  ASSERT_TRUE(typeface != nullptr);
+  auto glyphCache = context->resourceProvider()->colorGlyphCache();
+  glyphCache->releaseAll();
+  auto surface = Surface::Make(context, 200, 100);
+  auto canvas = surface->getCanvas();
+  Font font(typeface, 30);
+  Paint paint = {};
+  canvas->drawSimpleText("🤡👻🐠", 10, 40, font, paint);
+  EXPECT_EQ(glyphCache->glyphs.size(), 3u);
+  EXPECT_EQ(glyphCache->pages.size(), 1u);
+  auto opsTask = context->drawingManager()->activeOpsTask;
+  ASSERT_TRUE(opsTask != nullptr);
+  ASSERT_FALSE(opsTask->ops.empty());
+  ASSERT_EQ(opsTask->ops.back()->classID(), FillRectOp::ClassID());
+  EXPECT_EQ(static_cast<FillRectOp*>(opsTask->ops.back().get())->rectCount(), 3u);
+  // A slightly larger scale falls into the same size bucket and reuses the cached glyphs.
+  canvas->scale(1.05f, 1.05f);
+  canvas->drawSimpleText("🐠🤡", 10, 80, font, paint);
+  EXPECT_EQ(glyphCache->glyphs.size(), 3u);
+  EXPECT_EQ(context->drawingManager()->activeOpsTask, opsTask);
+  surface->flush();
+  EXPECT_TRUE(Baseline::Compare(surface, "CanvasTest/color_glyph_atlas"));
+  // Glyphs rasterized with faux bold are cached separately.
+  auto bucketFont = font.makeWithSize(ColorGlyphCache::BucketTextSize(font.getSize()));
+  auto glyphID = bucketFont.getGlyphID("🤡");
+  auto glyph = glyphCache->findOrAddGlyph(bucketFont, glyphID, 0);
+  ASSERT_TRUE(glyph != nullptr);
+  EXPECT_EQ(glyphCache->glyphs.size(), 3u);
+  bucketFont.setFauxBold(true);
+  auto boldGlyph = glyphCache->findOrAddGlyph(bucketFont, glyphID, 0);
+  ASSERT_TRUE(boldGlyph != nullptr);
+  EXPECT_NE(boldGlyph, glyph);
+  EXPECT_EQ(glyphCache->glyphs.size(), 4u);
+  // Glyphs that can not be cached are remembered, so they are not looked up again.
+  EXPECT_TRUE(glyphCache->findOrAddGlyph(bucketFont, 0, 0) == nullptr);
+  EXPECT_EQ(glyphCache->uncachedGlyphs.size(), 1u);
+  EXPECT_TRUE(glyphCache->findOrAddGlyph(bucketFont, 0, 0) == nullptr);
+  EXPECT_EQ(glyphCache->uncachedGlyphs.size(), 1u);
+  EXPECT_EQ(glyphCache->glyphs.size(), 4u);
+  device->unlock();
+}
 }  // namespace tgfx
@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <thread>
+#include "gpu/ShareGroup.h"
+#include "tgfx/core/Canvas.h"
+#include "tgfx/gpu/Surface.h"
+#include "utils/TestUtils.h"
+
+namespace tgfx {
+TGFX_TEST(DeviceTest, PinToCurrentThread) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  EXPECT_FALSE(device->isPinnedToCurrentThread());
+  ASSERT_TRUE(device->pinToCurrentThread());
+  EXPECT_TRUE(device->isPinnedToCurrentThread());
+  EXPECT_TRUE(device->pinToCurrentThread());
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 10, 10);
+  ASSERT_TRUE(surface != nullptr);
+  device->unlock();
+  // The context stays locked between lockContext() and unlock() calls on the pinned thread.
+  EXPECT_EQ(device->lockContext(), context);
+  surface->getCanvas()->clearRect(Rect::MakeWH(10, 10), Color::Red());
+  surface->flush();
+  device->unlock();
+
+  bool lockedByOtherThread = true;
+  bool pinnedByOtherThread = true;
+  std::thread thread([&]() {
+    lockedByOtherThread = device->locker.try_lock();
+    if (lockedByOtherThread) {
+      device->locker.unlock();
+    }
+    pinnedByOtherThread = device->pinToCurrentThread();
+  });
+  thread.join();
+  EXPECT_FALSE(lockedByOtherThread);
+  EXPECT_FALSE(pinnedByOtherThread);
+
+  EXPECT_EQ(device->lockContext(), context);
+  EXPECT_EQ(surface->getColor(0, 0), Color::Red());
+  device->unlock();
+  device->unpin();
+  EXPECT_FALSE(device->isPinnedToCurrentThread());
+  context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  surface = nullptr;
+  device->unlock();
+}
+
+TGFX_TEST(DeviceTest, ShareTextureAcrossContexts) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  device->unlock();
+  auto sharedDevice = GLDevice::Make(device->nativeHandle);
+  ASSERT_TRUE(sharedDevice != nullptr);
+  auto sharedContext = sharedDevice->lockContext();
+  ASSERT_TRUE(sharedContext != nullptr);
+  EXPECT_EQ(sharedContext->shareGroup(), context->shareGroup());
+  EXPECT_TRUE(sharedContext->shareGroup()->isShared());
+  sharedDevice->unlock();
+
+  auto image = MakeImage("resources/apitest/imageReplacement.png");
+  ASSERT_TRUE(image != nullptr);
+  context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, image->width(), image->height());
+  ASSERT_TRUE(surface != nullptr);
+  surface->getCanvas()->drawImage(image);
+  surface->flush();
+  device->unlock();
+
+  sharedContext = sharedDevice->lockContext();
+  ASSERT_TRUE(sharedContext != nullptr);
+  auto shareGroup = sharedContext->shareGroup();
+  EXPECT_EQ(shareGroup->records.size(), 1u);
+  auto sharedSurface = Surface::Make(sharedContext, image->width(), image->height());
+  ASSERT_TRUE(sharedSurface != nullptr);
+  sharedSurface->getCanvas()->drawImage(image);
+  Bitmap sharedBitmap(image->width(), image->height(), false, false);
+  ASSERT_FALSE(sharedBitmap.isEmpty());
+  Pixmap sharedPixmap(sharedBitmap);
+  EXPECT_TRUE(sharedSurface->readPixels(sharedPixmap.info(), sharedPixmap.writablePixels()));
+  sharedSurface = nullptr;
+  sharedDevice->unlock();
+
+  context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  Bitmap bitmap(image->width(), image->height(), false, false);
+  ASSERT_FALSE(bitmap.isEmpty());
+  Pixmap pixmap(bitmap);
+  EXPECT_TRUE(surface->readPixels(pixmap.info(), pixmap.writablePixels()));
+  EXPECT_EQ(memcmp(pixmap.pixels(), sharedPixmap.pixels(), pixmap.byteSize()), 0);
+  surface = nullptr;
+  device->unlock();
+  sharedPixmap.reset();
+  pixmap.reset();
+
+  image = nullptr;
+  sharedDevice = nullptr;
+  context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  context->purgeResourcesNotUsedSince(std::chrono::steady_clock::now());
+  EXPECT_TRUE(shareGroup->records.empty());
+  device->unlock();
+}
+
+TGFX_TEST(DeviceTest, ShareGroupIndependentOfLockOrder) {
+  auto device = GLDevice::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto sharedDevice = GLDevice::Make(device->nativeHandle);
+  ASSERT_TRUE(sharedDevice != nullptr);
+  auto chainedDevice = GLDevice::Make(sharedDevice->nativeHandle);
+  ASSERT_TRUE(chainedDevice != nullptr);
+  // Locks the devices created from a shared context before the root one.
+  auto chainedContext = chainedDevice->lockContext();
+  ASSERT_TRUE(chainedContext != nullptr);
+  auto chainedGroup = chainedContext->shareGroup();
+  chainedDevice->unlock();
+  auto sharedContext = sharedDevice->lockContext();
+  ASSERT_TRUE(sharedContext != nullptr);
+  EXPECT_EQ(sharedContext->shareGroup(), chainedGroup);
+  sharedDevice->unlock();
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  EXPECT_EQ(context->shareGroup(), chainedGroup);
+  device->unlock();
+}
+}  // namespace tgfx
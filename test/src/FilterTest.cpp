@@ -19,6 +19,7 @@
 #include <vector>
 #include "tgfx/core/Mask.h"
 #include "tgfx/core/PathEffect.h"
+#include "tgfx/core/Recorder.h"
 #include "tgfx/gpu/Surface.h"
 #include "utils/TestUtils.h"
 #include "vectors/freetype/FTMask.h"
@@ -231,6 +232,11 @@ TGFX_TEST(FilterTest, DropShadow) {
   EXPECT_EQ(bounds, Rect::MakeXYWH(10, 10, 13, 13));
   bounds = ImageFilter::DropShadowOnly(3, 3, 0, 0, Color::White())->filterBounds(src);
   EXPECT_EQ(bounds, Rect::MakeXYWH(13, 13, 10, 10));
+  bounds = filter->filterBounds(src, MapDirection::Reverse);
+  EXPECT_EQ(bounds, Rect::MakeXYWH(7, 7, 13, 13));
+  bounds = ImageFilter::DropShadowOnly(3, 3, 0, 0, Color::White())
+               ->filterBounds(src, MapDirection::Reverse);
+  EXPECT_EQ(bounds, Rect::MakeXYWH(7, 7, 10, 10));
 }
 
 TGFX_TEST(FilterTest, ImageFilterShader) {
@@ -294,5 +300,88 @@ TGFX_TEST(FilterTest, ComposeImageFilter) {
   canvas->drawImage(filterImage);
   EXPECT_TRUE(Baseline::Compare(surface, "FilterTest/ComposeImageFilter2"));
   device->unlock();
+
+  auto shiftFilter = ImageFilter::Compose(ImageFilter::DropShadowOnly(3, 3, 0, 0, Color::Black()),
+                                          ImageFilter::DropShadowOnly(2, 2, 0, 0, Color::Black()));
+  auto bounds = shiftFilter->filterBounds(Rect::MakeXYWH(10, 10, 10, 10), MapDirection::Reverse);
+  EXPECT_EQ(bounds, Rect::MakeXYWH(5, 5, 10, 10));
+  auto outputBounds = Rect::MakeXYWH(100, 100, 50, 50);
+  auto inputBounds = blackFilter->filterBounds(outputBounds, MapDirection::Reverse);
+  EXPECT_TRUE(blackFilter->filterBounds(inputBounds).contains(outputBounds));
+}
+
+TGFX_TEST(FilterTest, RRectShadow) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 200, 100);
+  auto canvas = surface->getCanvas();
+  Recorder recorder = {};
+  auto recordingCanvas = recorder.beginRecording();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  recordingCanvas->drawRoundRect(Rect::MakeXYWH(20, 20, 40, 40), 10, 10, paint);
+  auto picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  Paint layerPaint = {};
+  layerPaint.setImageFilter(ImageFilter::DropShadow(10, 10, 20, 20, Color::Black()));
+  canvas->drawPicture(picture, nullptr, &layerPaint);
+  auto matrix = Matrix::MakeTrans(100, 0);
+  layerPaint.setImageFilter(ImageFilter::DropShadowOnly(10, 10, 20, 20, Color::Black()));
+  canvas->drawPicture(picture, &matrix, &layerPaint);
+  EXPECT_EQ(surface->getColor(40, 40), Color::Red());
+  EXPECT_EQ(surface->getColor(5, 5), Color::Transparent());
+  auto shadow = surface->getColor(140, 40);
+  EXPECT_GT(shadow.alpha, 0.9f);
+  EXPECT_LT(shadow.red, 0.01f);
+  auto edge = surface->getColor(150, 72);
+  EXPECT_GT(edge.alpha, 0.0f);
+  EXPECT_LT(edge.alpha, shadow.alpha);
+  device->unlock();
+}
+
+TGFX_TEST(FilterTest, RRectShadowMatchesBlur) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  auto rRect = Rect::MakeXYWH(30, 30, 40, 40);
+  Recorder recorder = {};
+  auto recordingCanvas = recorder.beginRecording();
+  recordingCanvas->drawRoundRect(rRect, 10, 10, paint);
+  auto fastPicture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(fastPicture != nullptr);
+  // Drawing the same opaque shape twice leaves the layer unchanged but takes the layer through
+  // the blur filter, since the fast path only handles pictures with a single record.
+  recordingCanvas = recorder.beginRecording();
+  recordingCanvas->drawRoundRect(rRect, 10, 10, paint);
+  recordingCanvas->drawRoundRect(rRect, 10, 10, paint);
+  auto slowPicture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(slowPicture != nullptr);
+  Paint layerPaint = {};
+  layerPaint.setImageFilter(ImageFilter::DropShadow(8, 8, 10, 10, Color::Black()));
+  auto fastSurface = Surface::Make(context, 120, 120);
+  fastSurface->getCanvas()->drawPicture(fastPicture, nullptr, &layerPaint);
+  auto slowSurface = Surface::Make(context, 120, 120);
+  slowSurface->getCanvas()->drawPicture(slowPicture, nullptr, &layerPaint);
+  auto info = ImageInfo::Make(120, 120, ColorType::RGBA_8888);
+  std::vector<uint8_t> fastPixels(info.byteSize());
+  std::vector<uint8_t> slowPixels(info.byteSize());
+  ASSERT_TRUE(fastSurface->readPixels(info, fastPixels.data()));
+  ASSERT_TRUE(slowSurface->readPixels(info, slowPixels.data()));
+  int maxDifference = 0;
+  int totalDifference = 0;
+  for (size_t i = 0; i < fastPixels.size(); i++) {
+    auto difference = abs(static_cast<int>(fastPixels[i]) - static_cast<int>(slowPixels[i]));
+    maxDifference = std::max(maxDifference, difference);
+    totalDifference += difference;
+  }
+  // The Gaussian only approximates the dual blur, but they must stay close everywhere.
+  EXPECT_LE(maxDifference, 40);
+  EXPECT_LE(static_cast<float>(totalDifference) / static_cast<float>(fastPixels.size()), 4.0f);
+  device->unlock();
 }
 }  // namespace tgfx
@@ -0,0 +1,88 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2023 THL A29 Limited, a Tencent company. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "tgfx/core/Matrix.h"
+#include "utils/TestUtils.h"
+
+namespace tgfx {
+/**
+ * Returns points whose coordinates are exact in binary, so every matrix below maps them without
+ * rounding and the results can be compared exactly.
+ */
+static std::vector<Point> MakeTestPoints(int count) {
+  std::vector<Point> points = {};
+  for (int i = 0; i < count; i++) {
+    auto value = static_cast<float>(i);
+    points.push_back(Point::Make(value * 1.5f - 3.25f, 2.5f - value * 0.75f));
+  }
+  return points;
+}
+
+static void ExpectMapPointsMatchesMapXY(const Matrix& matrix) {
+  // Odd counts leave a point for the scalar tail after the SIMD loop, which handles two at a time.
+  for (int count : {1, 2, 3, 4, 5, 7, 8}) {
+    auto src = MakeTestPoints(count);
+    std::vector<Point> dst(static_cast<size_t>(count));
+    matrix.mapPoints(dst.data(), src.data(), count);
+    auto inPlace = src;
+    matrix.mapPoints(inPlace.data(), inPlace.data(), count);
+    for (size_t i = 0; i < src.size(); i++) {
+      Point expected = {};
+      matrix.mapXY(src[i].x, src[i].y, &expected);
+      EXPECT_EQ(dst[i], expected) << "count: " << count << ", index: " << i;
+      EXPECT_EQ(inPlace[i], expected) << "count: " << count << ", index: " << i;
+    }
+  }
+}
+
+static void ExpectMapRectMatchesCorners(const Matrix& matrix, const Rect& rect) {
+  Point corners[4] = {};
+  matrix.mapXY(rect.left, rect.top, &corners[0]);
+  matrix.mapXY(rect.right, rect.top, &corners[1]);
+  matrix.mapXY(rect.right, rect.bottom, &corners[2]);
+  matrix.mapXY(rect.left, rect.bottom, &corners[3]);
+  Rect expected = {};
+  expected.setBounds(corners, 4);
+  EXPECT_EQ(matrix.mapRect(rect), expected);
+}
+
+TGFX_TEST(MatrixTest, MapPoints) {
+  ExpectMapPointsMatchesMapXY(Matrix::I());
+  ExpectMapPointsMatchesMapXY(Matrix::MakeTrans(3.5f, -2.25f));
+  ExpectMapPointsMatchesMapXY(Matrix::MakeAll(2.0f, 0.0f, 3.5f, 0.0f, 0.5f, -1.0f));
+  ExpectMapPointsMatchesMapXY(Matrix::MakeAll(-1.5f, 0.0f, 4.0f, 0.0f, -2.0f, 0.25f));
+  ExpectMapPointsMatchesMapXY(Matrix::MakeAll(1.5f, 0.25f, 2.0f, -0.5f, 0.75f, -3.0f));
+  ExpectMapPointsMatchesMapXY(Matrix::MakeAll(0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f));
+  auto points = MakeTestPoints(3);
+  Matrix::MakeTrans(1.0f, 1.0f).mapPoints(points.data(), points.data(), 0);
+  EXPECT_EQ(points[0], Point::Make(-3.25f, 2.5f));
+}
+
+TGFX_TEST(MatrixTest, MapRect) {
+  auto rect = Rect::MakeLTRB(-2.5f, 1.0f, 6.0f, 3.75f);
+  ExpectMapRectMatchesCorners(Matrix::I(), rect);
+  ExpectMapRectMatchesCorners(Matrix::MakeTrans(3.5f, -2.25f), rect);
+  ExpectMapRectMatchesCorners(Matrix::MakeAll(2.0f, 0.0f, 3.5f, 0.0f, 0.5f, -1.0f), rect);
+  // Negative scales swap the two mapped corners, which must still produce a sorted rect.
+  ExpectMapRectMatchesCorners(Matrix::MakeAll(-1.5f, 0.0f, 4.0f, 0.0f, 1.0f, 0.25f), rect);
+  ExpectMapRectMatchesCorners(Matrix::MakeAll(1.0f, 0.0f, 4.0f, 0.0f, -2.0f, 0.25f), rect);
+  ExpectMapRectMatchesCorners(Matrix::MakeAll(-1.5f, 0.0f, 4.0f, 0.0f, -2.0f, 0.25f), rect);
+  ExpectMapRectMatchesCorners(Matrix::MakeAll(1.5f, 0.25f, 2.0f, -0.5f, 0.75f, -3.0f), rect);
+}
+}  // namespace tgfx
@@ -22,6 +22,11 @@
 #include "tgfx/core/Pixmap.h"
 #include "tgfx/gpu/Surface.h"
 #include "tgfx/opengl/GLDevice.h"
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(ANDROID)
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "tgfx/platform/linux/HardwareBufferFD.h"
+#endif
 #include "tgfx/utils/Buffer.h"
 #include "utils/TestUtils.h"
 
@@ -436,4 +441,60 @@ TGFX_TEST(ReadPixelsTest, JpegCodec) {
   CHECK_PIXELS(RGB565Info, pixels, "JpegCodec_Encode_RGB565");
 }
 
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(ANDROID)
+TGFX_TEST(ReadPixelsTest, HardwareBufferFD) {
+  auto hardwareBuffer = HardwareBufferAllocate(10, 10);
+  ASSERT_TRUE(hardwareBuffer != nullptr);
+  EXPECT_TRUE(HardwareBufferCheck(hardwareBuffer));
+  auto info = HardwareBufferGetInfo(hardwareBuffer);
+  EXPECT_EQ(info.width(), 10);
+  EXPECT_EQ(info.colorType(), ColorType::RGBA_8888);
+  auto pixels = HardwareBufferLock(hardwareBuffer);
+  ASSERT_TRUE(pixels != nullptr);
+  memset(pixels, 0, info.byteSize());
+  *reinterpret_cast<uint32_t*>(pixels) = 0xFF0000FF;
+  HardwareBufferUnlock(hardwareBuffer);
+
+  auto sharedBuffer = HardwareBufferFromFD(HardwareBufferGetFD(hardwareBuffer), info);
+  ASSERT_TRUE(sharedBuffer != nullptr);
+  pixels = HardwareBufferLock(sharedBuffer);
+  ASSERT_TRUE(pixels != nullptr);
+  EXPECT_EQ(*reinterpret_cast<uint32_t*>(pixels), 0xFF0000FFu);
+  HardwareBufferUnlock(sharedBuffer);
+
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto image = Image::MakeFrom(ImageBuffer::MakeFrom(sharedBuffer));
+  ASSERT_TRUE(image != nullptr);
+  auto surface = Surface::Make(context, 10, 10);
+  surface->getCanvas()->drawImage(image);
+  EXPECT_EQ(surface->getColor(0, 0), Color::Red());
+  EXPECT_EQ(surface->getColor(5, 5), Color::Transparent());
+  device->unlock();
+  HardwareBufferRelease(sharedBuffer);
+  HardwareBufferRelease(hardwareBuffer);
+}
+
+TGFX_TEST(ReadPixelsTest, HardwareBufferFDInvalid) {
+  auto fd = static_cast<int>(syscall(SYS_memfd_create, "tgfx-test", 0));
+  ASSERT_GE(fd, 0);
+  auto info = ImageInfo::Make(10, 10, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  ASSERT_EQ(ftruncate(fd, 16), 0);
+  // A file shorter than the pixels would raise SIGBUS when the pixels are touched.
+  EXPECT_TRUE(HardwareBufferFromFD(fd, info) == nullptr);
+  ASSERT_EQ(ftruncate(fd, static_cast<off_t>(info.byteSize())), 0);
+  auto hardwareBuffer = HardwareBufferFromFD(fd, info);
+  EXPECT_TRUE(hardwareBuffer != nullptr);
+  HardwareBufferRelease(hardwareBuffer);
+  auto alphaInfo = ImageInfo::Make(10, 10, ColorType::ALPHA_8, AlphaType::Premultiplied);
+  EXPECT_TRUE(HardwareBufferFromFD(fd, alphaInfo) == nullptr);
+  auto rowBytes = info.minRowBytes() + 4;
+  auto paddedInfo =
+      ImageInfo::Make(10, 5, ColorType::RGBA_8888, AlphaType::Premultiplied, rowBytes);
+  EXPECT_TRUE(HardwareBufferFromFD(fd, paddedInfo) == nullptr);
+  close(fd);
+}
+#endif
 }  // namespace tgfx
@@ -16,8 +16,11 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "gpu/DrawingManager.h"
+#include "gpu/tasks/RenderTargetCopyTask.h"
 #include "opengl/GLCaps.h"
 #include "opengl/GLUtil.h"
+#include "tgfx/gpu/Window.h"
 #include "tgfx/opengl/GLDevice.h"
 #include "utils/TestUtils.h"
 
@@ -77,4 +80,209 @@ TGFX_TEST(SurfaceTest, ImageSnapshot) {
   gl->deleteTextures(1, &textureInfo.id);
   device->unlock();
 }
+
+TGFX_TEST(SurfaceTest, DamagedBounds) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  ASSERT_TRUE(surface != nullptr);
+  EXPECT_TRUE(surface->getDamagedBounds().isEmpty());
+  auto canvas = surface->getCanvas();
+  Paint paint;
+  paint.setColor(Color::Red());
+  canvas->drawRect(Rect::MakeXYWH(10, 10, 20, 20), paint);
+  canvas->drawRect(Rect::MakeXYWH(50, 60, 10, 10), paint);
+  EXPECT_EQ(surface->getDamagedBounds(), Rect::MakeLTRB(10, 10, 60, 70));
+  surface->resetDamage();
+  EXPECT_TRUE(surface->getDamagedBounds().isEmpty());
+  canvas->save();
+  canvas->clipRect(Rect::MakeXYWH(0, 0, 40, 40));
+  canvas->drawRect(Rect::MakeXYWH(20, 20, 60, 60), paint);
+  canvas->restore();
+  EXPECT_EQ(surface->getDamagedBounds(), Rect::MakeLTRB(20, 20, 40, 40));
+  surface->resetDamage();
+  canvas->clear();
+  EXPECT_EQ(surface->getDamagedBounds(), Rect::MakeWH(100, 100));
+  device->unlock();
+}
+
+TGFX_TEST(SurfaceTest, PartialCopyOnWrite) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  ASSERT_TRUE(surface != nullptr);
+  auto canvas = surface->getCanvas();
+  canvas->clearRect(Rect::MakeWH(100, 100), Color::Blue());
+  auto snapshot = surface->makeImageSnapshot();
+  auto oldRenderTargetProxy = surface->renderTargetProxy;
+  Paint paint;
+  paint.setColor(Color::Red());
+  canvas->drawRect(Rect::MakeXYWH(10, 10, 20, 20), paint);
+  EXPECT_TRUE(surface->renderTargetProxy != oldRenderTargetProxy);
+  EXPECT_TRUE(surface->copySource == oldRenderTargetProxy);
+  ASSERT_EQ(surface->copiedRects.size(), 1u);
+  EXPECT_EQ(surface->copiedRects[0], Rect::MakeXYWH(10, 10, 20, 20));
+  canvas->drawRect(Rect::MakeXYWH(50, 10, 20, 20), paint);
+  ASSERT_EQ(surface->copiedRects.size(), 2u);
+  EXPECT_EQ(surface->copiedRects[1], Rect::MakeXYWH(50, 10, 20, 20));
+  canvas->drawRect(Rect::MakeXYWH(15, 15, 10, 10), paint);
+  EXPECT_EQ(surface->copiedRects.size(), 2u);
+  EXPECT_EQ(surface->getColor(15, 15), Color::Red());
+  EXPECT_EQ(surface->getColor(55, 15), Color::Red());
+  EXPECT_EQ(surface->getColor(40, 15), Color::Blue());
+  EXPECT_EQ(surface->getColor(90, 90), Color::Blue());
+  // Reading pixels only copies the pixels that are read.
+  EXPECT_TRUE(surface->copySource == oldRenderTargetProxy);
+
+  auto compareSurface = Surface::Make(context, 100, 100);
+  compareSurface->getCanvas()->drawImage(snapshot);
+  EXPECT_EQ(compareSurface->getColor(15, 15), Color::Blue());
+  EXPECT_EQ(compareSurface->getColor(55, 15), Color::Blue());
+
+  snapshot = surface->makeImageSnapshot();
+  canvas->clear();
+  EXPECT_TRUE(surface->copySource == nullptr);
+  EXPECT_EQ(surface->getColor(15, 15), Color::Transparent());
+  device->unlock();
+}
+
+static float CopiedPixelCount(Context* context) {
+  float count = 0;
+  for (auto& task : context->drawingManager()->renderTasks) {
+    auto copyTask = dynamic_cast<RenderTargetCopyTask*>(task.get());
+    if (copyTask != nullptr) {
+      count += copyTask->srcRect.width() * copyTask->srcRect.height();
+    }
+  }
+  return count;
+}
+
+TGFX_TEST(SurfaceTest, RepeatedSnapshotCopies) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  ASSERT_TRUE(surface != nullptr);
+  auto canvas = surface->getCanvas();
+  canvas->clearRect(Rect::MakeWH(100, 100), Color::Blue());
+  Paint paint;
+  paint.setColor(Color::Red());
+  auto compareSurface = Surface::Make(context, 100, 100);
+  for (int i = 0; i < 3; i++) {
+    auto snapshot = surface->makeImageSnapshot();
+    compareSurface->getCanvas()->drawImage(snapshot);
+    surface->flush();
+    auto offset = static_cast<float>(i * 10);
+    // Two small strokes in opposite corners only copy their own areas.
+    canvas->drawRect(Rect::MakeXYWH(offset, offset, 5.0f, 5.0f), paint);
+    canvas->drawRect(Rect::MakeXYWH(90.0f - offset, 90.0f - offset, 5.0f, 5.0f), paint);
+    EXPECT_EQ(surface->copiedRects.size(), 2u);
+    EXPECT_EQ(CopiedPixelCount(context), 50.0f);
+    // Releasing the snapshot lets the next one copy the drawn areas back instead of the rest.
+    snapshot = nullptr;
+    snapshot = surface->makeImageSnapshot();
+    EXPECT_TRUE(surface->copySource == nullptr);
+    EXPECT_EQ(CopiedPixelCount(context), 100.0f);
+    surface->flush();
+  }
+  EXPECT_EQ(surface->getColor(22, 22), Color::Red());
+  EXPECT_EQ(surface->getColor(72, 72), Color::Red());
+  EXPECT_EQ(surface->getColor(50, 50), Color::Blue());
+  EXPECT_EQ(compareSurface->getColor(22, 22), Color::Blue());
+  // Reading pixels while the snapshot is alive only copies the area that is read.
+  auto snapshot = surface->makeImageSnapshot();
+  canvas->drawRect(Rect::MakeXYWH(0, 0, 5, 5), paint);
+  EXPECT_EQ(surface->getColor(50, 50), Color::Blue());
+  EXPECT_TRUE(surface->copySource != nullptr);
+  ASSERT_EQ(surface->copiedRects.size(), 2u);
+  EXPECT_EQ(surface->copiedRects[1], Rect::MakeXYWH(50, 50, 1, 1));
+  device->unlock();
+}
+
+/**
+ * A window that draws into an offscreen surface and reports a fixed back buffer age.
+ */
+class DamageTestWindow : public Window {
+ public:
+  int bufferAge = 0;
+  std::vector<Rect> damageRegions = {};
+
+  explicit DamageTestWindow(std::shared_ptr<Device> device) : Window(std::move(device)) {
+  }
+
+ protected:
+  std::shared_ptr<Surface> onCreateSurface(Context* context) override {
+    return Surface::Make(context, 100, 100);
+  }
+
+  void onPresent(Context*, int64_t) override {
+  }
+
+  int onQueryBufferAge() override {
+    return bufferAge;
+  }
+
+  void onSetDamageRegion(const Rect& repaintRect) override {
+    damageRegions.push_back(repaintRect);
+  }
+};
+
+TGFX_TEST(SurfaceTest, WindowDamageAccumulation) {
+  auto device = DevicePool::Make();
+  ASSERT_TRUE(device != nullptr);
+  auto context = device->lockContext();
+  ASSERT_TRUE(context != nullptr);
+  DamageTestWindow window(device);
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  auto drawFrame = [&](const Rect& dirtyRect) {
+    auto repaintRect = window.setDirtyRect(context, dirtyRect);
+    auto surface = window.getSurface(context);
+    surface->getCanvas()->drawRect(dirtyRect, paint);
+    context->flush();
+    auto damage = surface->getDamagedBounds();
+    window.present(context);
+    return std::make_pair(repaintRect, damage);
+  };
+  auto bounds = Rect::MakeWH(100, 100);
+  // The content of the back buffer is unknown, so the whole window is repainted.
+  auto frame = drawFrame(Rect::MakeXYWH(10.f, 10.f, 10.f, 10.f));
+  EXPECT_EQ(frame.first, bounds);
+  ASSERT_EQ(window.damageRegions.size(), 1u);
+  EXPECT_EQ(window.damageRegions.back(), bounds);
+  // The back buffer holds the last frame, so only the dirty rect is repainted.
+  window.bufferAge = 1;
+  auto secondRect = Rect::MakeXYWH(40.5f, 40.f, 10.f, 10.f);
+  frame = drawFrame(secondRect);
+  auto expected = secondRect;
+  expected.roundOut();
+  EXPECT_EQ(frame.first, expected);
+  EXPECT_EQ(window.damageRegions.back(), expected);
+  auto secondDamage = frame.second;
+  EXPECT_FALSE(secondDamage.isEmpty());
+  // The back buffer misses the last frame, whose damage is added to the dirty rect.
+  window.bufferAge = 2;
+  auto thirdRect = Rect::MakeXYWH(70.f, 70.f, 10.f, 10.f);
+  frame = drawFrame(thirdRect);
+  expected = thirdRect;
+  expected.join(secondDamage);
+  EXPECT_EQ(frame.first, expected);
+  EXPECT_EQ(window.damageRegions.back(), expected);
+  // The back buffer is older than the remembered history, so the whole window is repainted.
+  window.bufferAge = 10;
+  frame = drawFrame(Rect::MakeXYWH(0.f, 0.f, 5.f, 5.f));
+  EXPECT_EQ(frame.first, bounds);
+  EXPECT_EQ(window.damageRegions.back(), bounds);
+  // A dirty rect outside of the window repaints nothing when the back buffer is up to date.
+  window.bufferAge = 1;
+  frame = drawFrame(Rect::MakeXYWH(200.f, 200.f, 10.f, 10.f));
+  EXPECT_TRUE(frame.first.isEmpty());
+  EXPECT_EQ(window.damageRegions.size(), 5u);
+  device->unlock();
+}
 }  // namespace tgfx